@@ -0,0 +1,75 @@
+#include "CoreBus.h"
+
+#include "pico/multicore.h"
+#include "hardware/irq.h"
+
+#define DOORBELL_VALUE 0xD00B
+
+void CoreBus::enableDoorbell()
+{
+    const uint32_t irq = get_core_num() == 0 ? SIO_IRQ_PROC0 : SIO_IRQ_PROC1;
+
+    multicore_fifo_drain();
+    multicore_fifo_clear_irq();
+    irq_set_exclusive_handler(irq, doorbellHandler);
+    irq_set_enabled(irq, true);
+}
+
+bool CoreBus::postCommand(const BusCommand& command)
+{
+    if (!commands.push(command))
+    {
+        droppedCommands++;
+        return false;
+    }
+
+    // with more queued, the audio core has not yet drained the ring and sees this one too
+    if (commands.placeLeft() == BUS_COMMAND_LENGTH - 1)
+    {
+        ringDoorbell();
+    }
+    return true;
+}
+
+bool CoreBus::receiveTelemetry(BusTelemetry* telemetry)
+{
+    return this->telemetry.pop(telemetry);
+}
+
+bool CoreBus::receiveCommand(BusCommand* command)
+{
+    return commands.pop(command);
+}
+
+bool CoreBus::postTelemetry(const BusTelemetry& telemetry)
+{
+    if (!this->telemetry.push(telemetry))
+    {
+        droppedTelemetry++;
+        return false;
+    }
+    return true;
+}
+
+//***************************************************************************************
+//* Raises the SIO interrupt of the audio core
+//*
+//* Never blocks: with the FIFO full the other core has not yet taken the previous
+//* doorbells and will see the new message anyway
+//***************************************************************************************
+void CoreBus::ringDoorbell()
+{
+    if (multicore_fifo_wready())
+    {
+        multicore_fifo_push_blocking(DOORBELL_VALUE);
+    }
+}
+
+//***************************************************************************************
+//* SIO interrupt, only acknowledges the doorbell, the loop reads the ring
+//***************************************************************************************
+void CoreBus::doorbellHandler()
+{
+    multicore_fifo_drain();
+    multicore_fifo_clear_irq();
+}
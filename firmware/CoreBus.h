@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdint.h>
+#include "SpscQueue.h"
+
+#define BUS_COMMAND_LENGTH 16   // has to be a power of two
+#define BUS_TELEMETRY_LENGTH 16 // has to be a power of two
+
+enum BusCommandType : uint8_t
+{
+    CMD_PLAY = 0,
+    CMD_PAUSE,
+    CMD_STOP,
+    CMD_SEEK,           // value is the song time in µs
+    CMD_VOLUME,         // value is the master volume in percent
+    CMD_LOAD_SONG       // value is the index of the song
+};
+
+// UI -> audio
+struct BusCommand
+{
+    BusCommandType type;
+    uint32_t value;
+};
+
+// audio -> UI, one snapshot per block
+struct BusTelemetry
+{
+    uint32_t sampleTime;    // samples rendered since the start
+    uint32_t underruns;     // DMA buffers that played before they were refilled
+    uint32_t peakLeft;      // highest output level of the block
+    uint32_t peakRight;
+    uint32_t songOrigin;    // sample at which the song time 0 plays, valid while songPlaying
+    uint8_t voices;         // voices in use
+    bool songPlaying;       // false while paused or stopped, also after the song ended
+    int8_t songStatus;      // result of the last song load, 0 or the error of SongSequencer::load
+};
+
+//***************************************************************************************
+//* Message bus between the UI on core 1 and the audio engine on core 0
+//*
+//* Each direction is a lock-free SPSC ring in shared SRAM, so neither side ever waits
+//* for the other. A full ring drops the message and counts it. The multicore FIFO is
+//* only used as a doorbell for commands: a command that makes the ring non-empty pushes
+//* one word, which raises the SIO interrupt of core 0 and wakes it from __wfi. The loop
+//* of core 0 takes the commands from the ring until it is empty, so later ones need no
+//* doorbell. Telemetry is posted every block and rings no doorbell, the UI polls it
+//* from its own tick instead of being interrupted ~100 times a second.
+//***************************************************************************************
+class CoreBus
+{
+    public:
+        static CoreBus& getInstance()
+        {
+            static CoreBus theOneToRuleThemAll;
+            return theOneToRuleThemAll;
+        }
+
+        // Installs the doorbell interrupt of the audio core, after core 1 was launched
+        void enableDoorbell();
+
+        // ** UI side **
+        bool postCommand(const BusCommand& command);
+        bool receiveTelemetry(BusTelemetry* telemetry);
+
+        // ** Audio side **
+        bool receiveCommand(BusCommand* command);
+        bool commandPending() { return !commands.empty(); }
+        bool postTelemetry(const BusTelemetry& telemetry);
+
+        uint32_t getDroppedCommands() { return droppedCommands; }
+        uint32_t getDroppedTelemetry() { return droppedTelemetry; }
+
+    private:
+        CoreBus() {}
+
+        static void ringDoorbell();
+        static void doorbellHandler();
+
+        SpscQueue<BusCommand, BUS_COMMAND_LENGTH> commands;
+        SpscQueue<BusTelemetry, BUS_TELEMETRY_LENGTH> telemetry;
+
+        // each written by the posting side only
+        uint32_t droppedCommands = 0;
+        uint32_t droppedTelemetry = 0;
+};
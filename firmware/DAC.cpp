@@ -25,83 +25,203 @@ extern const uint DEBUG2_PIN;
 extern const uint DEBUG3_PIN;
 extern const uint DEBUG4_PIN;
 
-#define OUTPUT_BUFFER_SIZE 2048
-
-static char strBuffer[100];
-volatile uint32_t outputBuffer[OUTPUT_BUFFER_SIZE] = {0};
+static uint32_t silentWord = 0; // read without increment while a half is silent
+static uint32_t holdWord = 0;   // read without increment while a late buffer holds the last frame
 
 void dma_handler();
 
 
-void DAC::setup(uint32_t lrclkPin, uint32_t bclkPin, uint32_t doutPin, uint32_t sampleRate)
+void DAC::setup(uint32_t lrclkPin, uint32_t bclkPin, uint32_t doutPin, uint32_t sampleRate, DACFormat format)
 {
     // Set up the GPIO pins
     this->lrclkPin = lrclkPin;
     this->bclkPin = bclkPin;
     this->doutPin = doutPin;
+    this->sampleRate = sampleRate;
+    this->format = format;
+    wordsPerFrame = format == DAC_FORMAT_PACKED16 ? 1 : 2;
 
     // ** PIO initialisation **
     pio = pio0;
     sm = pio_claim_unused_sm(pio, true);
-    offset = pio_add_program(pio, &i2s_program);
-    i2s_program_init(pio, sm, offset, lrclkPin, bclkPin, doutPin, sampleRate);
+    if (format == DAC_FORMAT_PACKED16)
+    {
+        offset = pio_add_program(pio, &i2s16_program);
+        i2s16_program_init(pio, sm, offset, lrclkPin, bclkPin, doutPin, sampleRate);
+    }
+    else
+    {
+        offset = pio_add_program(pio, &i2s_program);
+        i2s_program_init(pio, sm, offset, lrclkPin, bclkPin, doutPin, sampleRate);
+    }
 
     pio_sm_set_enabled(pio, sm, true);
 
-    // Set up the DMA
+    // Set up the DMA channels
+    dmaChannels[0] = dma_claim_unused_channel(true);
+    dmaChannels[1] = dma_claim_unused_channel(true);
+
+    irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
+    irq_set_enabled(DMA_IRQ_0, true);
+}
+
+//***************************************************************************************
+//* Starts the output of bufferCount buffers of bufferSize words, played in a loop
+//*
+//* buffer holds all of them back to back, is owned by the caller and has to stay
+//* valid until stop(). More buffers let the caller render further ahead, fewer and
+//* smaller ones lower the latency.
+//***************************************************************************************
+void DAC::start(volatile uint32_t* buffer, uint32_t bufferCount, uint32_t bufferSize)
+{
+    stop();
+
+    outputBuffer = buffer;
+    this->bufferCount = bufferCount;
+    this->bufferSize = bufferSize;
+    completedBuffers = 0;
+    filledBuffers = 0;
+    readyBuffers = 0;
+    bufferDurationUs = (uint64_t)(bufferSize / wordsPerFrame) * 1000000 / sampleRate;
+    resetStats();
+    nextBufferToFill = 0;
+    silentBuffers = 0;
+    heldBuffers = 0;
+    holdWord = 0;
+    for (uint32_t i = 0; i < bufferCount * bufferSize; i++)
+    {
+        buffer[i] = 0;
+    }
+
     DMASetup();
 }
 
+// Stops the output, the PIO keeps shifting out the last sample
+void DAC::stop()
+{
+    if (outputBuffer == nullptr)
+    {
+        return;
+    }
+
+    dma_channel_set_irq0_enabled(dmaChannels[0], false);
+    dma_channel_set_irq0_enabled(dmaChannels[1], false);
+    dma_channel_abort(dmaChannels[0]);
+    dma_channel_abort(dmaChannels[1]);
+    dma_hw->ints0 = (1u << dmaChannels[0]) | (1u << dmaChannels[1]);
+
+    outputBuffer = nullptr;
+}
+
 // Set up the DMA to feed the FIFO of PIO0_SM0.
 // Two channels are used in a way that one channel is always active
-// while the other one can be written to by the CPU. If the active burst is
-// finished, the DMA switches to the other channel.
+// while the other one is armed with the following buffer. If the active burst is
+// finished, the DMA switches to the other channel and the finished one is armed
+// with the buffer after that, so both channels leapfrog around the ring.
 void DAC::DMASetup()
 {
-    // Set up the DMA channels
-    dmaChannels[0] = dma_claim_unused_channel(true);
-    dmaChannels[1] = dma_claim_unused_channel(true);
-
-    // Set up the DMA control block
-    dma_channel_config dmaConfig1 = dma_channel_get_default_config(dmaChannels[0]);
-    channel_config_set_transfer_data_size(&dmaConfig1, DMA_SIZE_32);
-    channel_config_set_read_increment(&dmaConfig1, true);
-    channel_config_set_write_increment(&dmaConfig1, false);
-    channel_config_set_dreq(&dmaConfig1, pio_get_dreq(pio, sm, true));
-    channel_config_set_chain_to(&dmaConfig1, dmaChannels[1]);
-
-    dma_channel_configure(dmaChannels[0], &dmaConfig1,
-                          &pio->txf[sm],          // write address
-                          outputBuffer,           // read address
-                          OUTPUT_BUFFER_SIZE / 2, // element count
-                          false                   // start immediately
-    );
-
-    dma_channel_config dmaConfig2 = dma_channel_get_default_config(dmaChannels[1]);
-    channel_config_set_transfer_data_size(&dmaConfig2, DMA_SIZE_32);
-    channel_config_set_read_increment(&dmaConfig2, true);
-    channel_config_set_write_increment(&dmaConfig2, false);
-    channel_config_set_dreq(&dmaConfig2, pio_get_dreq(pio, sm, true));
-    channel_config_set_chain_to(&dmaConfig2, dmaChannels[0]);
-
-    dma_channel_configure(dmaChannels[1], &dmaConfig2,
-                          &pio->txf[sm],                         // write address
-                          outputBuffer + OUTPUT_BUFFER_SIZE / 2, // read address
-                          OUTPUT_BUFFER_SIZE / 2,                // element count
-                          false                                  // start immediately
-    );
-
-    // Set up the DMA interrupt
-    dma_channel_set_irq0_enabled(dmaChannels[0], true);
-    dma_channel_set_irq0_enabled(dmaChannels[1], true);
-
-    irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
-    irq_set_enabled(DMA_IRQ_0, true);
+    for (uint32_t half = 0; half < 2; half++)
+    {
+        // Set up the DMA control block
+        dma_channel_config &dmaConfig = dmaConfigs[half];
+        dmaConfig = dma_channel_get_default_config(dmaChannels[half]);
+        channel_config_set_transfer_data_size(&dmaConfig, DMA_SIZE_32);
+        channel_config_set_read_increment(&dmaConfig, true);
+        channel_config_set_write_increment(&dmaConfig, false);
+        channel_config_set_dreq(&dmaConfig, pio_get_dreq(pio, sm, true));
+        channel_config_set_chain_to(&dmaConfig, dmaChannels[half ^ 1]);
+
+        dma_channel_configure(dmaChannels[half], &dmaConfig,
+                              &pio->txf[sm],                      // write address
+                              outputBuffer + half * bufferSize,   // read address
+                              bufferSize,                         // element count
+                              false                               // start immediately
+        );
+        armedBuffers[half] = half % bufferCount;
+
+        // Set up the DMA interrupt
+        dma_channel_set_irq0_enabled(dmaChannels[half], true);
+    }
 
     // Start the DMA
     dma_channel_start(dmaChannels[0]);
 }
 
+// Points the idle channel of half at the given buffer or at the zero word if
+// the buffer is silent
+void DAC::armChannel(uint32_t half, uint32_t bufferIdx)
+{
+    const uint32_t channel = dmaChannels[half];
+    armedBuffers[half] = bufferIdx;
+
+    if (silentBuffers & (1u << bufferIdx))
+    {
+        dma_channel_config silentConfig = dmaConfigs[half];
+        channel_config_set_read_increment(&silentConfig, false);
+        dma_channel_set_config(channel, &silentConfig, false);
+        dma_channel_set_read_addr(channel, &silentWord, false);
+    }
+    else
+    {
+        dma_channel_set_config(channel, &dmaConfigs[half], false);
+        dma_channel_set_read_addr(channel, outputBuffer + bufferIdx * bufferSize, false);
+    }
+    // a late buffer may have been restarted with fewer words
+    dma_channel_set_trans_count(channel, bufferSize, false);
+}
+
+//***************************************************************************************
+//* Restarts the running channel of half, which plays a buffer that was not refilled in
+//* time, on the constant word of the underrun policy
+//*
+//* Runs in the IRQ right after the buffer started, so only a few words of it were read.
+//* The audio buffers are not written, the caller may still be filling the late one.
+//***************************************************************************************
+void DAC::replaceLateBuffer(uint32_t half, uint32_t lateBuffer)
+{
+    uint32_t *word = &silentWord;
+    if (underrunPolicy == DAC_UNDERRUN_HOLD)
+    {
+        word = &holdWord;
+        heldBuffers |= 1u << lateBuffer;
+    }
+
+    if (restartOnWord(half, word))
+    {
+        silentBuffers = silentBuffers | (1u << lateBuffer);
+    }
+}
+
+//***************************************************************************************
+//* Aborts the running channel of half and plays the rest of its buffer from word
+//*
+//* Returns false if the channel had already finished, then it is left alone.
+//***************************************************************************************
+bool DAC::restartOnWord(uint32_t half, uint32_t *word)
+{
+    // abort can raise the IRQ of the channel (RP2040-E13), so it is masked meanwhile
+    const uint32_t channel = dmaChannels[half];
+    dma_channel_set_irq0_enabled(channel, false);
+    dma_channel_abort(channel);
+    const uint32_t remaining = dma_hw->ch[channel].transfer_count;
+    if (remaining != 0)
+    {
+        dma_hw->ints0 = 1u << channel;
+    }
+    dma_channel_set_irq0_enabled(channel, true);
+    if (remaining == 0)
+    {
+        return false;
+    }
+
+    dma_channel_config wordConfig = dmaConfigs[half];
+    channel_config_set_read_increment(&wordConfig, false);
+    dma_channel_set_config(channel, &wordConfig, false);
+    dma_channel_set_read_addr(channel, word, false);
+    dma_channel_set_trans_count(channel, remaining, true);
+    return true;
+}
+
 int32_t DAC::getChannelThatFired()
 {
     return dma_channel_get_irq0_status(dmaChannels[0]) ? 0 : 1;
@@ -110,34 +230,168 @@ int32_t DAC::getChannelThatFired()
 
 void DAC::interruptHandler()
 {
-    uint32_t completedChannel = getChannelThatFired();
-    dma_channel_set_read_addr(completedChannel, outputBuffer + (completedChannel == 1 ? OUTPUT_BUFFER_SIZE / 2 : 0), 0);
+    uint32_t completedHalf = getChannelThatFired();
+    uint32_t completedBuffer = armedBuffers[completedHalf];
+    uint32_t startedBuffer = armedBuffers[completedHalf ^ 1];
+    const bool completedSilent = silentBuffers & (1u << completedBuffer);
+
+    // the played buffer is free again, it plays from the buffer unless it is silenced once more
+    silentBuffers = silentBuffers & ~(1u << completedBuffer);
+    const bool completedHeld = heldBuffers & (1u << completedBuffer);
+    heldBuffers &= ~(1u << completedBuffer);
+    freedTimes[completedBuffer] = time_us_32();
+    const uint32_t completed = completedBuffers + 1;
+    completedBuffers = completed;
+
+    // the buffer that just started was freed bufferCount buffers ago, it has to be ready since
+    if ((int32_t)(readyBuffers - (completed - bufferCount + 1)) < 0)
+    {
+        stats.underruns++;
+        if (underrunPolicy == DAC_UNDERRUN_HOLD && !completedSilent)
+        {
+            // the completed buffer is free now, but the caller fills the late one first. A
+            // stereo frame has one word per channel, both hold their mean.
+            const volatile uint32_t *lastFrame = outputBuffer + (completedBuffer + 1) * bufferSize - wordsPerFrame;
+            holdWord = wordsPerFrame == 1 ? lastFrame[0] : (uint32_t)(((int32_t)lastFrame[0] >> 1) + ((int32_t)lastFrame[1] >> 1));
+        }
+        else if (!completedHeld)
+        {
+            holdWord = 0;
+        }
+
+        if (underrunPolicy != DAC_UNDERRUN_NONE)
+        {
+            replaceLateBuffer(completedHalf ^ 1, startedBuffer);
+        }
+    }
 
-    bufferToFill = completedChannel + 1;
+    // the other channel plays the next buffer, this one takes the one after it
+    armChannel(completedHalf, (completedBuffer + 2) % bufferCount);
 
     // Clear the interrupt request.
-    dma_hw->ints0 = 1u << completedChannel;
+    dma_hw->ints0 = 1u << dmaChannels[completedHalf];
 
 }
 
+//***************************************************************************************
+//* Returns the next buffer that has been played and can be filled again
+//*
+//* Buffers are handed out in the order they are played. getFreeBuffers tells how many
+//* can be filled ahead.
+//***************************************************************************************
 bool DAC::cyclicHandler(volatile uint32_t** buffer, uint32_t *bufferLength)
 {
-    if (bufferToFill == 0)
+    if (outputBuffer == nullptr || getFreeBuffers() == 0)
     {
-        return 0;
+        return false;
     }
 
-    const size_t start = bufferToFill == 1 ? 0 : (OUTPUT_BUFFER_SIZE >> 1);
-    const size_t end = start + (OUTPUT_BUFFER_SIZE >> 1);
-
-    *buffer = &outputBuffer[start];
-    *bufferLength = OUTPUT_BUFFER_SIZE >> 1;
+    // skip buffers that already started playing, the IRQ counted them as underruns
+    while (getFreeBuffers() >= bufferCount)
+    {
+        nextBufferToFill = (nextBufferToFill + 1) % bufferCount;
+        filledBuffers = filledBuffers + 1;
+        readyBuffers = readyBuffers + 1;
+    }
 
+    *buffer = &outputBuffer[nextBufferToFill * bufferSize];
+    *bufferLength = bufferSize;
 
-    bufferToFill = 0;
+    nextBufferToFill = (nextBufferToFill + 1) % bufferCount;
+    filledBuffers = filledBuffers + 1;
     return true;
 }
 
+//***************************************************************************************
+//* Lets buffer play zeros instead of its content
+//*
+//* buffer has to be the one returned by cyclicHandler. Its channel is switched to
+//* read the zero word without increment, so the buffer itself does not need to be
+//* written. After it has been played, the buffer is used normally again, so output
+//* resumes at the next buffer boundary without a glitch.
+//***************************************************************************************
+void DAC::playSilence(volatile uint32_t* buffer)
+{
+    const uint32_t bufferIdx = (buffer - outputBuffer) / bufferSize;
+
+    // the IRQ must not rearm a channel in between
+    uint32_t interrupts = save_and_disable_interrupts();
+    silentBuffers = silentBuffers | (1u << bufferIdx);
+
+    // already armed, switch the idle channel directly
+    for (uint32_t half = 0; half < 2; half++)
+    {
+        const uint32_t channel = dmaChannels[half];
+        if (armedBuffers[half] != bufferIdx)
+        {
+            continue;
+        }
+        if (!dma_channel_is_busy(channel))
+        {
+            armChannel(half, bufferIdx);
+        }
+
+        // the other channel can finish at any time and start this one through chain_to,
+        // also while it is rewritten. Then it is restarted on the zero word like a late
+        // buffer, after at most a few words of the buffer.
+        if (dma_channel_is_busy(channel))
+        {
+            restartOnWord(half, &silentWord);
+        }
+    }
+    restore_interrupts(interrupts);
+}
+
+//***************************************************************************************
+//* time_us_64 at which a buffer handed out by cyclicHandler starts playing
+//*
+//* It was freed when it finished playing and is queued behind the other buffers of
+//* the ring, so it plays again bufferCount - 1 buffer durations later
+//***************************************************************************************
+uint64_t DAC::getPlayStartUs(const volatile uint32_t* buffer)
+{
+    const uint32_t bufferIdx = (buffer - outputBuffer) / bufferSize;
+    const uint32_t start = freedTimes[bufferIdx] + (bufferCount - 1) * bufferDurationUs;
+
+    const uint64_t now = time_us_64();
+    return now + (int32_t)(start - (uint32_t)now);
+}
+
+//***************************************************************************************
+//* Marks buffer as completely refilled, after it was written or silenced
+//*
+//* Updates the slack statistics, the buffer is due bufferCount - 1 buffers after it
+//* was played.
+//***************************************************************************************
+void DAC::bufferReady(volatile uint32_t* buffer)
+{
+    const uint32_t bufferIdx = (buffer - outputBuffer) / bufferSize;
+    const uint32_t fillTime = time_us_32() - freedTimes[bufferIdx];
+    const int32_t slack = (int32_t)((bufferCount - 1) * bufferDurationUs - fillTime);
+
+    stats.maxFillTimeUs = MAX(stats.maxFillTimeUs, fillTime);
+    stats.worstSlackUs = MIN(stats.worstSlackUs, slack);
+    readyBuffers = readyBuffers + 1;
+}
+
+void DAC::resetStats()
+{
+    stats = {};
+    stats.worstSlackUs = INT32_MAX;
+}
+
+//***************************************************************************************
+//* Time until a sample written into the next free buffer is output
+//*
+//* Counts all buffers that are queued before it, including the one that is playing
+//***************************************************************************************
+uint32_t DAC::getLatencyUs()
+{
+    const uint32_t queuedBuffers = bufferCount - getFreeBuffers();
+    const uint32_t frames = queuedBuffers * (bufferSize / wordsPerFrame);
+    return (uint64_t)frames * 1000000 / sampleRate;
+}
+
 void dma_handler()
 {
     DAC *dac = &DAC::getInstance();
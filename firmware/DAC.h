@@ -3,8 +3,31 @@
 #include "pico/stdlib.h"
 #include <stdio.h>
 #include "hardware/pio.h"
+#include "hardware/dma.h"
 #include "Tone.h"
 
+enum DACFormat
+{
+    DAC_FORMAT_STEREO32 = 0,    // two 32 bit words per frame, left and right
+    DAC_FORMAT_PACKED16         // one word per frame, left in the upper and right in the lower 16 bits
+};
+
+struct DACStats
+{
+    uint32_t underruns;         // buffers that started playing before they were refilled
+    uint32_t maxFillTimeUs;     // longest time from a buffer being played to it being refilled
+    int32_t worstSlackUs;       // least time left until a refilled buffer was played, negative if late
+};
+
+// What a buffer that was not refilled in time plays instead. The buffer is already being
+// read by the DMA, so its channel is restarted on a constant word for the rest of it.
+enum DACUnderrunPolicy
+{
+    DAC_UNDERRUN_NONE = 0,      // the stale content of the buffer is played
+    DAC_UNDERRUN_ZERO,          // silence
+    DAC_UNDERRUN_HOLD           // the last frame played before, avoids a click in sustained sounds
+};
+
 class DAC {
     public:
         static DAC& getInstance()
@@ -15,7 +38,22 @@ class DAC {
         
         void interruptHandler();
         bool cyclicHandler(volatile uint32_t** buffer, uint32_t *bufferLength);
-        void setup(uint32_t lrclkPin, uint32_t bclkPin, uint32_t doutPin, uint32_t sampleRate);
+        void setup(uint32_t lrclkPin, uint32_t bclkPin, uint32_t doutPin, uint32_t sampleRate, DACFormat format = DAC_FORMAT_STEREO32);
+        void start(volatile uint32_t* buffer, uint32_t bufferCount, uint32_t bufferSize);
+        void stop();
+        void playSilence(volatile uint32_t* buffer);
+        void bufferReady(volatile uint32_t* buffer);
+
+        uint32_t getFreeBuffers() { return completedBuffers - filledBuffers; }
+        uint32_t getBufferCount() { return bufferCount; }
+        DACFormat getFormat() { return format; }
+        uint32_t getLatencyUs();
+        uint64_t getPlayStartUs(const volatile uint32_t* buffer);
+
+        DACStats getStats() { return stats; }
+        void resetStats();
+        void setUnderrunPolicy(DACUnderrunPolicy policy) { underrunPolicy = policy; }
+        DACUnderrunPolicy getUnderrunPolicy() { return underrunPolicy; }
     private:
         DAC() {}
 
@@ -27,12 +65,38 @@ class DAC {
         uint32_t sm; 
         uint32_t offset;
 
+        uint32_t sampleRate;
+        DACFormat format;
+        uint32_t wordsPerFrame;
+
         uint32_t dmaChannels[2] = {0};
-        uint8_t bufferToFill = 0; // 1 for first half, 2 for second half, 0 for none
+        dma_channel_config dmaConfigs[2];
+        uint8_t armedBuffers[2] = {0};      // buffer each channel plays next or is playing
+
+        // ring of output buffers, owned by the caller of start()
+        volatile uint32_t* outputBuffer = nullptr;
+        uint32_t bufferCount = 0;
+        uint32_t bufferSize = 0;            // words per buffer
+
+        // free running counters, each written by one side only
+        volatile uint32_t completedBuffers = 0; // played buffers, written by the IRQ
+        volatile uint32_t filledBuffers = 0;    // buffers handed out by cyclicHandler
+        volatile uint32_t readyBuffers = 0;     // buffers refilled completely, written by bufferReady
+        uint8_t nextBufferToFill = 0;           // written by cyclicHandler
+        volatile uint32_t silentBuffers = 0;    // bit n is set if buffer n is played from the zero word
+        uint32_t heldBuffers = 0;               // bit n is set if buffer n is played from the hold word, written by the IRQ
+
+        // deadline tracking
+        uint32_t freedTimes[32] = {0};          // time_us_32 when buffer n was played, written by the IRQ
+        uint32_t bufferDurationUs = 0;
+        DACStats stats = {};
+        DACUnderrunPolicy underrunPolicy = DAC_UNDERRUN_ZERO;
 
         void DMASetup();
+        void armChannel(uint32_t half, uint32_t bufferIdx);
+        void replaceLateBuffer(uint32_t half, uint32_t lateBuffer);
+        bool restartOnWord(uint32_t half, uint32_t *word);
         int32_t getChannelThatFired();
-        void computeBuffer();
 
     public:
         DAC(DAC const&)             = delete;
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+#define MASTER_GAIN_SHIFT 16 // gains are fixed point with this many fractional bits
+#define MASTER_GAIN_UNITY (1u << MASTER_GAIN_SHIFT)
+
+//***************************************************************************************
+//* Master volume of the audio engine, may be set from either core
+//*
+//* The gain is published with a single store, the engine reads it once per block and
+//* ramps towards it. Both sides only use a plain load or store of one word, so neither
+//* takes a lock nor waits for the other. The UI sends its slider as CMD_VOLUME.
+//***************************************************************************************
+class MasterVolume
+{
+    public:
+        static MasterVolume& getInstance()
+        {
+            static MasterVolume theOneToRuleThemAll;
+            return theOneToRuleThemAll;
+        }
+
+        // ** Control side **
+        // Volume in percent, the gain follows its square like the velocity
+        void setVolume(uint8_t percent)
+        {
+            if (percent > 100)
+            {
+                percent = 100;
+            }
+            gain.store(percent * percent * MASTER_GAIN_UNITY / 10000, std::memory_order_relaxed);
+        }
+
+        // ** Audio side **
+        uint32_t getGain() const { return gain.load(std::memory_order_relaxed); }
+
+        // sample * gain without a 64 bit product, which the M0+ has to do in software
+        static int32_t scale(int32_t sample, uint32_t gain)
+        {
+            return (sample >> MASTER_GAIN_SHIFT) * (int32_t)gain
+                 + (int32_t)(((uint32_t)sample & (MASTER_GAIN_UNITY - 1)) * gain >> MASTER_GAIN_SHIFT);
+        }
+
+    private:
+        MasterVolume() {}
+
+        std::atomic<uint32_t> gain = MASTER_GAIN_UNITY;
+};
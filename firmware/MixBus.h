@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+
+// The voices are summed at 1/2^MIX_HEADROOM_BITS of their output level, so even 32
+// voices at full volume and in phase fit into the 32 bit bus without saturating
+#define MIX_HEADROOM_BITS 3
+#define SOFTCLIP_STEPS 256
+
+//***************************************************************************************
+//* Output stage of the mix bus, restores the level and limits it softly to full scale
+//*
+//* Below the knee at half scale the bus is passed through linearly. Above it the level
+//* follows a tanh curve that approaches full scale with a continuous slope, so loud
+//* passages compress instead of clipping hard. The curve is a table generated by the
+//* compiler, only samples above the knee need the interpolation.
+//***************************************************************************************
+class SoftClip
+{
+    public:
+        static const int32_t FULL_SCALE = INT32_MAX >> MIX_HEADROOM_BITS; // in bus units
+        static const int32_t KNEE = (FULL_SCALE + 1) / 2;
+        static const int32_t RANGE = FULL_SCALE + 1 - KNEE; // headroom above the knee
+
+        constexpr SoftClip()
+        {
+            for (uint32_t i = 0; i <= SOFTCLIP_STEPS; i++)
+            {
+                const double value = RANGE * tanhSeries((double)i * SPAN / SOFTCLIP_STEPS) + 0.5;
+                curve[i] = value < RANGE ? (int32_t)value : RANGE - 1;
+            }
+        }
+
+        // Bus value to output sample
+        constexpr int32_t operator()(int32_t bus) const
+        {
+            const int32_t magnitude = bus < 0 ? -bus : bus;
+            if (magnitude <= KNEE)
+            {
+                return bus * (1 << MIX_HEADROOM_BITS);
+            }
+
+            const uint32_t distance = magnitude - KNEE;
+            const uint32_t idx = distance / STEP_SIZE;
+            int32_t shaped;
+            if (idx >= SOFTCLIP_STEPS)
+            {
+                shaped = curve[SOFTCLIP_STEPS];
+            }
+            else
+            {
+                const int32_t fraction = (distance % STEP_SIZE) >> (STEP_SHIFT - 8);
+                shaped = curve[idx] + (((curve[idx + 1] - curve[idx]) * fraction) >> 8);
+            }
+
+            const int32_t output = (KNEE + shaped) * (1 << MIX_HEADROOM_BITS);
+            return bus < 0 ? -output : output;
+        }
+
+    private:
+        static const uint32_t SPAN = 4; // the table covers tanh(0) to tanh(4), 0.9993 of RANGE
+        static const uint32_t STEP_SIZE = SPAN * RANGE / SOFTCLIP_STEPS;
+        static const uint32_t STEP_SHIFT = __builtin_ctz(STEP_SIZE);
+        static_assert((STEP_SIZE & (STEP_SIZE - 1)) == 0, "Table steps have to be a power of two");
+
+        int32_t curve[SOFTCLIP_STEPS + 1] = {};
+
+        // tanh(x) for 0 <= x <= SPAN by the Taylor series of exp, precise to double
+        static constexpr double tanhSeries(double x)
+        {
+            double term = 1;
+            double exp2x = 1;
+            for (int i = 1; i < 80; i++)
+            {
+                term *= 2 * x / i;
+                exp2x += term;
+            }
+            return (exp2x - 1) / (exp2x + 1);
+        }
+};
+
+inline constexpr SoftClip softClip;
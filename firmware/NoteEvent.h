@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+struct NoteEvent
+{
+    uint32_t stepSize;      // phase increment of the tone
+    uint32_t startTime;     // start time in samples
+    uint32_t duration;      // duration in samples
+    uint8_t envelopeIdx;    // index into the envelope table of the sheduler
+    uint8_t velocity;
+    uint8_t pan;            // MIDI pan position, see PanTable.h
+};
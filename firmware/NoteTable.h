@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+
+#define NOTE_NUMBER 128
+#define FINE_TUNE_STEPS 16 // per semitone, 6.25 cent each
+
+//***************************************************************************************
+//* Phase increments of all MIDI notes at SampleRate
+//*
+//* The table is generated by the compiler and ends up in flash, so starting a note
+//* needs neither powf nor a soft-float division. Each semitone is divided into
+//* FINE_TUNE_STEPS steps for detuning.
+//***************************************************************************************
+template <uint32_t SampleRate>
+class NoteTable
+{
+    public:
+        static constexpr uint32_t getStepSize(uint8_t note, uint8_t fineTune = 0)
+        {
+            return table.steps[note * FINE_TUNE_STEPS + fineTune];
+        }
+
+        // Notes above half the sample rate would alias
+        static constexpr bool isPlayable(uint8_t note, uint8_t fineTune = 0)
+        {
+            return note < NOTE_NUMBER && fineTune < FINE_TUNE_STEPS && getStepSize(note, fineTune) < (1u << 31);
+        }
+
+    private:
+        struct Table
+        {
+            uint32_t steps[NOTE_NUMBER * FINE_TUNE_STEPS];
+        };
+
+        // 2^x for 0 <= x < 1 by its Taylor series, precise to double
+        static constexpr double exp2Fraction(double x)
+        {
+            const double LN2 = 0.693147180559945309417;
+            double term = 1;
+            double sum = 1;
+            for (int i = 1; i < 30; i++)
+            {
+                term *= x * LN2 / i;
+                sum += term;
+            }
+            return sum;
+        }
+
+        static constexpr Table generate()
+        {
+            Table result = {};
+            for (uint32_t i = 0; i < NOTE_NUMBER * FINE_TUNE_STEPS; i++)
+            {
+                // distance to A4 (note 69, 440 Hz) in fine tune steps, split into octaves
+                // and the rest, so the series only has to cover one octave
+                const int32_t STEPS_PER_OCTAVE = 12 * FINE_TUNE_STEPS;
+                const int32_t distance = (int32_t)i - 69 * FINE_TUNE_STEPS + 10 * STEPS_PER_OCTAVE;
+                const int32_t octave = distance / STEPS_PER_OCTAVE - 10;
+                const double fraction = (double)(distance % STEPS_PER_OCTAVE) / STEPS_PER_OCTAVE;
+
+                double frequency = 440.0 * exp2Fraction(fraction);
+                for (int32_t o = 0; o < octave; o++)
+                {
+                    frequency *= 2;
+                }
+                for (int32_t o = 0; o > octave; o--)
+                {
+                    frequency /= 2;
+                }
+
+                const double step = frequency * 4294967296.0 / SampleRate + 0.5;
+                result.steps[i] = step >= 4294967295.0 ? UINT32_MAX : (uint32_t)step;
+            }
+            return result;
+        }
+
+        static constexpr Table table = generate();
+};
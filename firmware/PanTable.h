@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+
+#define PAN_STEPS 128
+#define PAN_LEFT 0
+#define PAN_CENTER 64
+#define PAN_RIGHT 127
+#define PAN_GAIN_SHIFT 8 // gains are fixed point with this many fractional bits
+
+// Gains of the left and right channel for one pan position
+struct PanGains
+{
+    uint16_t left;
+    uint16_t right;
+};
+
+//***************************************************************************************
+//* Constant-power pan law for MIDI pan positions (0 left, 64 center, 127 right)
+//*
+//* left² + right² stays at one for every position, so a voice keeps its loudness while
+//* it moves across the stereo field. As in General MIDI 2, 0 and 1 are both hard left.
+//* The table is generated by the compiler like the NoteTable.
+//***************************************************************************************
+class PanTable
+{
+    public:
+        constexpr PanTable()
+        {
+            const double HALF_PI = 1.57079632679489661923;
+            for (uint32_t pan = 0; pan < PAN_STEPS; pan++)
+            {
+                const double angle = (pan > 1 ? pan - 1 : 0) * HALF_PI / (PAN_STEPS - 2);
+                gains[pan].left = toGain(sine(HALF_PI - angle));
+                gains[pan].right = toGain(sine(angle));
+            }
+        }
+
+        constexpr PanGains operator[](uint8_t pan) const
+        {
+            return gains[pan < PAN_STEPS ? pan : PAN_RIGHT];
+        }
+
+    private:
+        PanGains gains[PAN_STEPS] = {};
+
+        // sin(x) for 0 <= x <= pi/2 by its Taylor series, precise to double
+        static constexpr double sine(double x)
+        {
+            double term = x;
+            double sum = x;
+            for (int i = 1; i < 15; i++)
+            {
+                term *= -x * x / ((2 * i) * (2 * i + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        static constexpr uint16_t toGain(double gain)
+        {
+            return (uint16_t)(gain * (1 << PAN_GAIN_SHIFT) + 0.5);
+        }
+};
+
+inline constexpr PanTable panTable;
@@ -0,0 +1,139 @@
+#include "SongSequencer.h"
+
+#include <algorithm>
+
+//***************************************************************************************
+//* Sets the song to play, its envelopes replace the table of the sheduler
+//*
+//* The tones and pans are referenced, not copied, so they have to stay valid while the
+//* song is loaded.
+//* Returns -6 if a tone refers to an envelope the song does not have, the sheduler
+//* would reject all of its notes, and -7 if a tone's channel has no pan. Songs without
+//* pans play centered.
+//***************************************************************************************
+int SongSequencer::load(std::span<const ui_tone> tones, const std::vector<AdsrProfile> &envelopes, std::span<const uint8_t> channelPans)
+{
+    stop();
+
+    for (const ui_tone &tone : tones)
+    {
+        if (tone.envelopeIdx >= envelopes.size())
+        {
+            return -6;
+        }
+        if (!channelPans.empty() && tone.channelIdx >= channelPans.size())
+        {
+            return -7;
+        }
+    }
+
+    int result = sheduler.loadEnvelopes(envelopes.data(), envelopes.size());
+    if (result < 0)
+    {
+        return result;
+    }
+
+    this->tones = tones;
+    this->channelPans = channelPans;
+    cursor = 0;
+    return 0;
+}
+
+void SongSequencer::play()
+{
+    if (playing)
+    {
+        return;
+    }
+
+    // the song continues with the next block the sheduler renders
+    origin = sheduler.getSampleTime() - sheduler.microsToSamples(pausedPosition);
+    cursor = findTone(pausedPosition);
+    playing = true;
+}
+
+//***************************************************************************************
+//* Stops at the current position, the notes that were queued ahead are dropped
+//***************************************************************************************
+void SongSequencer::pause()
+{
+    if (!playing)
+    {
+        return;
+    }
+
+    pausedPosition = getPosition();
+    playing = false;
+    sheduler.stopAll();
+}
+
+void SongSequencer::stop()
+{
+    pause();
+    pausedPosition = 0;
+    cursor = 0;
+}
+
+void SongSequencer::seek(uint32_t position_us)
+{
+    const bool wasPlaying = playing;
+    pause();
+    pausedPosition = position_us;
+    cursor = findTone(position_us);
+    if (wasPlaying)
+    {
+        play();
+    }
+}
+
+//***************************************************************************************
+//* Queues the notes of the look-ahead window, call it from the main loop
+//*
+//* A note that does not fit into the full job queue stays at the cursor and is queued
+//* by a later call. Notes the sheduler rejects otherwise are skipped and counted.
+//***************************************************************************************
+void SongSequencer::update()
+{
+    if (!playing)
+    {
+        return;
+    }
+
+    const uint32_t windowEnd = getPosition() + SEQUENCER_LOOKAHEAD_US;
+    while (cursor < tones.size() && tones[cursor].startTime < windowEnd && sheduler.getPlaceLeftInQueue() > 0)
+    {
+        const ui_tone &tone = tones[cursor];
+        const uint8_t pan = channelPans.empty() ? PAN_CENTER : channelPans[tone.channelIdx];
+        const int result = sheduler.addNoteAbs(tone.note, origin + sheduler.microsToSamples(tone.startTime), sheduler.microsToSamples(tone.duration),
+                                               tone.envelopeIdx, MIN(tone.velocity, 127), 0, pan);
+        if (result == -4)
+        {
+            break;
+        }
+        if (result < 0)
+        {
+            stats.rejectedNotes++;
+            stats.lastError = result;
+        }
+        cursor++;
+    }
+}
+
+// Song time in µs of the next block the sheduler renders
+uint32_t SongSequencer::getPosition()
+{
+    if (!playing)
+    {
+        return pausedPosition;
+    }
+    const uint32_t samples = sheduler.getSampleTime() - origin;
+    return (uint64_t)samples * 1'000'000 / ToneSheduler<>::SAMPLE_RATE;
+}
+
+// Index of the first tone that starts at or after position_us
+uint32_t SongSequencer::findTone(uint32_t position_us)
+{
+    auto tone = std::lower_bound(tones.begin(), tones.end(), position_us,
+        [](const ui_tone &tone, uint32_t time) { return tone.startTime < time; });
+    return tone - tones.begin();
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include <span>
+#include <vector>
+#include "ToneSheduler.h"
+#include "ui_songs/ui_tone.h"
+
+#define SEQUENCER_LOOKAHEAD_US 250'000 // notes are queued this far ahead of the playback
+
+struct SequencerStats
+{
+    uint32_t rejectedNotes;     // notes the sheduler refused and that were skipped
+    int32_t lastError;          // error of addNoteAbs for the last rejected note
+};
+
+//***************************************************************************************
+//* Streams the tones of a song into the ToneSheduler
+//*
+//* A cursor walks the tones, which are sorted by start time. update() only queues the
+//* notes that start within SEQUENCER_LOOKAHEAD_US and only as long as the job queue
+//* has room, so the whole song never has to fit into the scheduler. Seeking moves the
+//* cursor by a binary search on the start times.
+//***************************************************************************************
+class SongSequencer
+{
+    public:
+        SongSequencer(ToneSheduler<> &sheduler) : sheduler(sheduler) {}
+
+        int load(std::span<const ui_tone> tones, const std::vector<AdsrProfile> &envelopes, std::span<const uint8_t> channelPans);
+        void play();
+        void pause();
+        void stop();
+        void seek(uint32_t position_us);
+        void update();
+
+        bool isPlaying() { return playing; }
+        bool isFinished() { return cursor == tones.size(); }
+        uint32_t getPosition();
+        uint32_t getOrigin() { return origin; } // sample of the sheduler at which the song started, while playing
+
+        SequencerStats getStats() { return stats; }
+        void resetStats() { stats = {}; }
+
+    private:
+        uint32_t findTone(uint32_t position_us);
+
+        ToneSheduler<> &sheduler;
+
+        std::span<const ui_tone> tones;
+        std::span<const uint8_t> channelPans;
+
+        uint32_t cursor = 0;            // next tone to queue
+        bool playing = false;
+        uint32_t pausedPosition = 0;    // song time in µs while not playing
+        uint32_t origin = 0;            // sample time of the sheduler at song time 0 while playing
+
+        SequencerStats stats = {};
+};
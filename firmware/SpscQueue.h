@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+//***************************************************************************************
+//* Lock-free single-producer/single-consumer ring buffer
+//*
+//* The storage is part of the object, so there is no heap usage. Producer and
+//* consumer may run on different cores. Only plain loads and stores with
+//* acquire/release ordering are used, which the Cortex-M0+ supports without
+//* atomic read-modify-write instructions.
+//***************************************************************************************
+template <typename T, uint32_t Capacity>
+class SpscQueue
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity has to be a power of two");
+
+    public:
+        // ** Producer side **
+        bool push(const T& item)
+        {
+            const uint32_t tail = this->tail.load(std::memory_order_relaxed);
+            if (tail - this->head.load(std::memory_order_acquire) == Capacity)
+            {
+                return false;
+            }
+
+            items[tail & (Capacity - 1)] = item;
+            this->tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        uint32_t placeLeft() const
+        {
+            return Capacity - (this->tail.load(std::memory_order_relaxed) - this->head.load(std::memory_order_acquire));
+        }
+
+        // ** Consumer side **
+        bool empty() const
+        {
+            return this->head.load(std::memory_order_relaxed) == this->tail.load(std::memory_order_acquire);
+        }
+
+        // only valid if the queue is not empty
+        const T& front() const
+        {
+            return items[this->head.load(std::memory_order_relaxed) & (Capacity - 1)];
+        }
+
+        void pop()
+        {
+            this->head.store(this->head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        bool pop(T* item)
+        {
+            if (empty())
+            {
+                return false;
+            }
+            *item = front();
+            pop();
+            return true;
+        }
+
+        void clear()
+        {
+            this->head.store(this->tail.load(std::memory_order_acquire), std::memory_order_release);
+        }
+
+        static constexpr uint32_t capacity() { return Capacity; }
+
+    private:
+        T items[Capacity];
+        std::atomic<uint32_t> head = 0; // written by the consumer only
+        std::atomic<uint32_t> tail = 0; // written by the producer only
+};
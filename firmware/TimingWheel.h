@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stdint.h>
+#include "NoteEvent.h"
+
+#define WHEEL_SIZE 128          // number of buckets, has to be a power of two
+#define WHEEL_POOL_SIZE 256     // number of events the wheel can hold
+
+//***************************************************************************************
+//* Timing wheel that sorts note events into buckets by audio block
+//*
+//* Events can be inserted in any order in O(1). Popping only touches the buckets of
+//* the requested block. Events further ahead than WHEEL_SIZE blocks share a bucket with
+//* earlier blocks and are skipped until their block comes up.
+//*
+//* One bucket covers BlockFrames samples, the block size of the scheduler that pops the
+//* events. Times are compared wrap-safe, so the wheel keeps working when the sample
+//* counter overflows.
+//***************************************************************************************
+template <uint32_t BlockFrames>
+class TimingWheel
+{
+    public:
+        TimingWheel();
+
+        bool insert(const NoteEvent& event, uint32_t earliestBlock);
+        uint32_t popDue(uint32_t startTime, uint32_t endTime, NoteEvent* events, uint32_t maxEvents);
+        void clear();
+
+        bool empty() const { return count == 0; }
+        bool full() const { return freeList == NO_NODE; }
+        uint32_t size() const { return count; }
+
+        static uint32_t getBlock(uint32_t time) { return time / BlockFrames; }
+
+    private:
+        static_assert((WHEEL_SIZE & (WHEEL_SIZE - 1)) == 0, "WHEEL_SIZE has to be a power of two");
+        static_assert(BlockFrames > 0 && (BlockFrames & (BlockFrames - 1)) == 0, "BlockFrames has to be a power of two");
+        static_assert(WHEEL_POOL_SIZE < UINT16_MAX, "Node indices are 16 bit");
+
+        static const uint16_t NO_NODE = UINT16_MAX;
+        static const uint32_t BLOCK_MASK = UINT32_MAX / BlockFrames; // block numbers wrap with the sample counter
+
+        static void insertSorted(NoteEvent* events, uint32_t eventCount, const NoteEvent& event);
+
+        struct Node
+        {
+            NoteEvent event;
+            uint16_t next;
+        };
+
+        Node pool[WHEEL_POOL_SIZE];
+        uint16_t buckets[WHEEL_SIZE];
+        uint16_t freeList;
+        uint32_t count;
+};
+
+#include "TimingWheel.tpp"
@@ -0,0 +1,143 @@
+//***************************************************************************************
+//* Implementation of TimingWheel, included by TimingWheel.h
+//***************************************************************************************
+
+#pragma once
+
+template <uint32_t BlockFrames>
+TimingWheel<BlockFrames>::TimingWheel()
+{
+    clear();
+}
+
+//***************************************************************************************
+//* Drops all events
+//***************************************************************************************
+template <uint32_t BlockFrames>
+void TimingWheel<BlockFrames>::clear()
+{
+    for (uint32_t i = 0; i < WHEEL_SIZE; i++)
+    {
+        buckets[i] = NO_NODE;
+    }
+    for (uint32_t i = 0; i < WHEEL_POOL_SIZE; i++)
+    {
+        pool[i].next = i + 1 < WHEEL_POOL_SIZE ? i + 1 : NO_NODE;
+    }
+    freeList = 0;
+    count = 0;
+}
+
+//***************************************************************************************
+//* Adds an event to the bucket of its start block
+//*
+//* Events that start before earliestBlock are put into the bucket of earliestBlock,
+//* so late events are started as soon as possible
+//***************************************************************************************
+template <uint32_t BlockFrames>
+bool TimingWheel<BlockFrames>::insert(const NoteEvent& event, uint32_t earliestBlock)
+{
+    if (full())
+    {
+        return false;
+    }
+
+    uint32_t block = getBlock(event.startTime);
+    if ((int32_t)(event.startTime - earliestBlock * BlockFrames) < 0)
+    {
+        block = earliestBlock;
+    }
+
+    const uint16_t node = freeList;
+    freeList = pool[node].next;
+
+    uint16_t &bucket = buckets[block & (WHEEL_SIZE - 1)];
+    pool[node].event = event;
+    pool[node].next = bucket;
+    bucket = node;
+    count++;
+    return true;
+}
+
+//***************************************************************************************
+//* Removes the events that start before endTime from the buckets of the blocks
+//* between startTime and endTime
+//*
+//* The events are returned sorted by start time. If there are more than maxEvents,
+//* the earliest ones are returned and the others are moved to the bucket of the block
+//* of endTime, so they come up again with the next block.
+//***************************************************************************************
+template <uint32_t BlockFrames>
+uint32_t TimingWheel<BlockFrames>::popDue(uint32_t startTime, uint32_t endTime, NoteEvent* events, uint32_t maxEvents)
+{
+    uint32_t eventCount = 0;
+    const uint32_t firstBlock = getBlock(startTime);
+    const uint32_t blockCount = ((getBlock(endTime - 1) - firstBlock) & BLOCK_MASK) + 1;
+    const uint32_t nextBucket = getBlock(endTime) & (WHEEL_SIZE - 1);
+
+    for (uint32_t i = 0; i < blockCount; i++)
+    {
+        const uint32_t bucket = (firstBlock + i) & (WHEEL_SIZE - 1);
+        uint16_t *link = &buckets[bucket];
+        while (*link != NO_NODE)
+        {
+            const uint16_t node = *link;
+            NoteEvent &event = pool[node].event;
+
+            // later revolution of the wheel
+            if ((int32_t)(event.startTime - endTime) >= 0)
+            {
+                link = &pool[node].next;
+                continue;
+            }
+
+            if (eventCount == maxEvents)
+            {
+                // no room left, the latest due event waits for the next block
+                if (maxEvents > 0 && (int32_t)(events[maxEvents - 1].startTime - event.startTime) > 0)
+                {
+                    const NoteEvent latest = events[--eventCount];
+                    insertSorted(events, eventCount++, event);
+                    event = latest;
+                }
+
+                if (bucket == nextBucket)
+                {
+                    link = &pool[node].next;
+                }
+                else
+                {
+                    *link = pool[node].next;
+                    pool[node].next = buckets[nextBucket];
+                    buckets[nextBucket] = node;
+                }
+                continue;
+            }
+
+            insertSorted(events, eventCount++, event);
+
+            // unlink and free the node
+            *link = pool[node].next;
+            pool[node].next = freeList;
+            freeList = node;
+            count--;
+        }
+    }
+
+    return eventCount;
+}
+
+//***************************************************************************************
+//* Inserts an event into the first eventCount events, which are sorted by start time
+//***************************************************************************************
+template <uint32_t BlockFrames>
+void TimingWheel<BlockFrames>::insertSorted(NoteEvent* events, uint32_t eventCount, const NoteEvent& event)
+{
+    uint32_t j = eventCount;
+    while (j > 0 && (int32_t)(events[j - 1].startTime - event.startTime) > 0)
+    {
+        events[j] = events[j - 1];
+        j--;
+    }
+    events[j] = event;
+}
@@ -1,8 +1,7 @@
 #include "Tone.h"
 
 #include "math.h"
-
-#define LUT_SIZE 256
+#include "MixBus.h"
 
 extern const uint DEBUG1_PIN;
 extern const uint DEBUG2_PIN;
@@ -19,9 +18,11 @@ typedef enum
     ADSR_DONE
 } ADSRState_t;
 
+static uint32_t segmentLength(uint32_t distance, uint32_t rate);
+
 // global variables
 static int sineLUT[LUT_SIZE];
-static char strBuffer[100];
+[[maybe_unused]] static char strBuffer[100]; // debug output of enterADSRState
 
 void Tone::setupSine()
 {
@@ -32,7 +33,7 @@ void Tone::setupSine()
         sineLUT[i] = (int)(INT24_MAX * sinf((float)i * 2 * M_PI / (float)LUT_SIZE) * 0.15f);
 
         //add harmonics
-        const uint32_t NUM_HARMONICS = 5;
+        // const uint32_t NUM_HARMONICS = 5;
         
         // for (size_t harmonic = 2; harmonic <= NUM_HARMONICS; harmonic++)
         // {
@@ -52,9 +53,11 @@ Tone::Tone()
     this->ADSRState = ADSR_DONE;
 }
 
-Tone::Tone(float frequency, uint32_t duration, uint32_t attack, uint32_t decay, uint32_t sustain, uint32_t release)
+Tone::Tone(uint32_t stepSize, uint32_t duration, uint32_t attack, uint32_t decay, uint32_t sustain, uint32_t release, uint8_t pan, uint8_t velocity)
 {
-    this->stepSize = (uint32_t)((float)(frequency * (LUT_SIZE<<6))/ 48000.0f );
+    this->stepSize = stepSize;
+    this->panGains = panTable[pan];
+    this->velocityGain = velocityCurve[velocity];
 
     this->attackStepSize = attack;
     this->decayStepSize = decay;
@@ -63,6 +66,7 @@ Tone::Tone(float frequency, uint32_t duration, uint32_t attack, uint32_t decay,
 
     cyclesLeft = duration;
 
+    enterADSRState(ADSR_RISING);
 }
 
 Tone::~Tone()
@@ -71,14 +75,43 @@ Tone::~Tone()
 
 void Tone::stop()
 {
-    this->ADSRState = ADSR_RELEASED;
+    if (this->ADSRState != ADSR_DONE)
+    {
+        enterADSRState(ADSR_RELEASED);
+    }
 }
 
-uint32_t Tone::nextSample()
+//***************************************************************************************
+//* Releases the tone within the given number of samples, used to silence a stolen
+//* voice without a click
+//***************************************************************************************
+void Tone::fadeOut(uint32_t frames)
 {
-    this->accumulator += this->stepSize;
-    uint8_t index = this->accumulator >> 6;
-    return sineLUT[index] * this->nextADSRVolume();
+    if (this->ADSRState != ADSR_DONE)
+    {
+        this->releaseStepSize = this->ADSRVolume / frames + 1;
+        enterADSRState(ADSR_RELEASED);
+    }
+}
+
+//***************************************************************************************
+//* Restarts the envelope with the parameters of tone
+//*
+//* Phase and current volume are kept, so the attack continues from the current
+//* level without a discontinuity
+//***************************************************************************************
+void Tone::retrigger(const Tone& tone)
+{
+    this->stepSize = tone.stepSize;
+    this->panGains = tone.panGains;
+    this->velocityGain = tone.velocityGain;
+    this->attackStepSize = tone.attackStepSize;
+    this->decayStepSize = tone.decayStepSize;
+    this->sustainLevel = tone.sustainLevel;
+    this->releaseStepSize = tone.releaseStepSize;
+    this->cyclesLeft = tone.cyclesLeft;
+
+    enterADSRState(ADSR_RISING);
 }
 
 bool Tone::isDone()
@@ -86,51 +119,124 @@ bool Tone::isDone()
     return this->ADSRState == ADSR_DONE;
 }
 
-uint32_t Tone::nextADSRVolume()
+bool Tone::isReleased()
 {
-    uint32_t volume = this->ADSRVolume >> 23;
-    cyclesLeft--;
+    return this->ADSRState == ADSR_RELEASED;
+}
 
-    switch (this->ADSRState)
+//***************************************************************************************
+//* Adds the output of this tone for the next frames stereo frames to accum
+//*
+//* The envelope is rendered as linear segments, so the state machine only runs
+//* at segment boundaries and not for every sample. The mono sample is weighted with
+//* the gain pair of the pan position, accum holds interleaved left and right sums.
+//* The voices are added at bus level, MIX_HEADROOM_BITS below the output, so the sums
+//* can't overflow and need no saturation. The velocity gain is applied to the ramp of
+//* each segment, so it costs nothing per sample.
+//***************************************************************************************
+void Tone::renderBlock(int32_t* accum, uint32_t frames)
+{
+    while (frames > 0 && this->ADSRState != ADSR_DONE)
     {
-    case ADSR_RISING:
-        this->ADSRVolume += this->attackStepSize;
-        if (this->ADSRVolume >= INT32_MAX)
+        const uint32_t segmentFrames = this->segmentLeft < frames ? this->segmentLeft : frames;
+        const uint32_t step = this->stepSize;
+        const int32_t slope = this->ADSRSlope;
+        uint32_t phase = this->accumulator;
+        const int64_t gain = this->velocityGain;
+        // scaled once per segment, with the slope rounded towards zero the ramp ends at
+        // most one step below zero, which the signed shift keeps silent
+        uint32_t volume = ((uint64_t)this->ADSRVolume * gain) >> VELOCITY_GAIN_SHIFT;
+        const int32_t scaledSlope = (slope * gain) / (1 << VELOCITY_GAIN_SHIFT);
+        const int32_t gainLeft = this->panGains.left;
+        const int32_t gainRight = this->panGains.right;
+
+        for (uint32_t i = 0; i < segmentFrames; i++)
         {
-            this->ADSRVolume = INT32_MAX;
-            this->ADSRState = ADSR_FALLING;
+            phase += step;
+            const int32_t sample = (sineLUT[phase >> LUT_SHIFT] * ((int32_t)volume >> 23)) >> (PAN_GAIN_SHIFT + MIX_HEADROOM_BITS);
+            accum[2*i] += sample * gainLeft;
+            accum[2*i + 1] += sample * gainRight;
+            volume += scaledSlope;
         }
 
-        break;
-    case ADSR_FALLING:
-        this->ADSRVolume -= this->decayStepSize;
-        if (this->ADSRVolume <= this->sustainLevel || this->ADSRVolume >= ((uint32_t)INT32_MAX+1))
+        this->accumulator = phase;
+        this->ADSRVolume += (uint32_t)slope * segmentFrames;
+        this->cyclesLeft -= segmentFrames;
+        this->segmentLeft -= segmentFrames;
+        accum += 2 * segmentFrames;
+        frames -= segmentFrames;
+
+        if (this->segmentLeft == 0)
         {
-            this->ADSRVolume = this->sustainLevel;
-            this->ADSRState = (this->ADSRVolume >= ((uint32_t) INT32_MAX+1) || this->ADSRVolume == 0) ? ADSR_DONE : ADSR_SUSTAIN; //if sustain level is 0, we are done
+            nextADSRState();
         }
+    }
+}
+
+//***************************************************************************************
+//* Finishes the current segment of the envelope and enters the following one
+//***************************************************************************************
+void Tone::nextADSRState()
+{
+    switch (this->ADSRState)
+    {
+    case ADSR_RISING:
+        this->ADSRVolume = INT32_MAX;
+        enterADSRState(ADSR_FALLING);
+        break;
+    case ADSR_FALLING:
+        this->ADSRVolume = this->sustainLevel;
+        //if sustain level is 0, we are done
+        enterADSRState((this->ADSRVolume >= ((uint32_t) INT32_MAX+1) || this->ADSRVolume == 0) ? ADSR_DONE : ADSR_SUSTAIN);
         break;
     case ADSR_SUSTAIN:
-        if (cyclesLeft <= 0)
-        {
-            this->ADSRState = ADSR_RELEASED;
-        }
+        enterADSRState(ADSR_RELEASED);
         break;
     case ADSR_RELEASED:
-        
-        this->ADSRVolume -= this->releaseStepSize;
-        if (this->ADSRVolume >= ((uint32_t) INT32_MAX+1) || this->ADSRVolume == 0) //overflow occured
-        {
-            this->ADSRVolume = 0;
-            this->ADSRState = ADSR_DONE;
-        }
-        break;
-    case ADSR_DONE:
         this->ADSRVolume = 0;
+        enterADSRState(ADSR_DONE);
         break;
     default:
         break;
     }
+}
+
+//***************************************************************************************
+//* Sets up the linear segment of the given envelope state
+//*
+//* segmentLeft is the number of samples until the state changes, these are
+//* exactly the samples the per-sample state machine spent in that state
+//***************************************************************************************
+void Tone::enterADSRState(uint32_t state)
+{
+    const uint32_t volume = this->ADSRVolume;
+    this->ADSRState = state;
+
+    switch (state)
+    {
+    case ADSR_RISING:
+        this->ADSRSlope = this->attackStepSize;
+        this->segmentLeft = segmentLength(INT32_MAX - volume, this->attackStepSize);
+        break;
+    case ADSR_FALLING:
+        this->ADSRSlope = -(int32_t)this->decayStepSize;
+        this->segmentLeft = volume > this->sustainLevel ? segmentLength(volume - this->sustainLevel, this->decayStepSize) : 1;
+        break;
+    case ADSR_SUSTAIN:
+        this->ADSRSlope = 0;
+        this->segmentLeft = this->cyclesLeft > 1 ? this->cyclesLeft : 1;
+        break;
+    case ADSR_RELEASED:
+        this->ADSRSlope = -(int32_t)this->releaseStepSize;
+        this->segmentLeft = segmentLength(volume, this->releaseStepSize);
+        break;
+    case ADSR_DONE:
+    default:
+        this->ADSRVolume = 0;
+        this->ADSRSlope = 0;
+        this->segmentLeft = 0;
+        break;
+    }
 
 #if 0
     //debug
@@ -147,6 +253,22 @@ uint32_t Tone::nextADSRVolume()
         uart_puts(uart0, strBuffer);
     }
 #endif
+}
 
-    return volume;
-}
\ No newline at end of file
+//***************************************************************************************
+//* Number of samples a ramp with the given rate needs to cover distance
+//*
+//* Always at least one sample, a rate of 0 never ends
+//***************************************************************************************
+static uint32_t segmentLength(uint32_t distance, uint32_t rate)
+{
+    if (distance == 0)
+    {
+        return 1;
+    }
+    if (rate == 0)
+    {
+        return UINT32_MAX;
+    }
+    return (distance - 1) / rate + 1;
+}
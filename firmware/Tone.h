@@ -2,36 +2,60 @@
 
 #include "pico/stdlib.h"
 #include <stdio.h>
+#include "PanTable.h"
+#include "VelocityCurve.h"
 
+#define LUT_SIZE 256
+#define LUT_SHIFT 24 // the top 8 bits of the 32 bit phase index the LUT
 
 class Tone
 {
     public:
         static void setupSine();
+        // Phase increment per sample for the given frequency at SampleRate, a full
+        // turn of the 32 bit phase is one period. See NoteTable.h for MIDI notes.
+        template <uint32_t SampleRate>
+        static constexpr uint32_t getStepSize(float frequency)
+        {
+            return (uint32_t)(frequency * (4294967296.0f / SampleRate));
+        }
 
         Tone();
-        Tone(float frequency, uint32_t duration, uint32_t attack, uint32_t decay, uint32_t sustain, uint32_t release);
+        Tone(uint32_t stepSize, uint32_t duration, uint32_t attack, uint32_t decay, uint32_t sustain, uint32_t release, uint8_t pan = PAN_CENTER, uint8_t velocity = 127);
         ~Tone();
         void stop();
+        void fadeOut(uint32_t frames);
+        void retrigger(const Tone& tone);
         bool isDone();
-        uint32_t nextSample(); // should be called at 48kHz
+        bool isReleased();
+        uint32_t getVolume() { return ADSRVolume; }
+        uint32_t getPhaseStep() { return stepSize; }
+        void renderBlock(int32_t* accum, uint32_t frames); // adds the next frames stereo frames to accum, interleaved L/R
     private:
         //debug
         uint32_t oldState = 0;
 
         uint32_t stepSize;
-        volatile uint32_t accumulator;
+        uint32_t accumulator = 0;
 
-        volatile uint32_t ADSRVolume = 0;
-        volatile uint32_t ADSRState = 0;
+        uint32_t ADSRVolume = 0;
+        uint32_t ADSRState = 0;
 
-        volatile int32_t cyclesLeft = 0;
+        int32_t cyclesLeft = 0;
+
+        // current linear segment of the envelope
+        int32_t ADSRSlope = 0;
+        uint32_t segmentLeft = 0;
 
         uint32_t attackStepSize;
         uint32_t decayStepSize;
         uint32_t sustainLevel;
         uint32_t releaseStepSize;
 
-        uint32_t nextADSRVolume();
+        PanGains panGains = panTable[PAN_CENTER];
+        uint16_t velocityGain = velocityCurve[127];
+
+        void enterADSRState(uint32_t state);
+        void nextADSRState();
 
-};
\ No newline at end of file
+};
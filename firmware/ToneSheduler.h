@@ -2,66 +2,187 @@
 
 #include "pico/stdlib.h"
 #include <stdio.h>
-#include <queue>
 #include "DAC.h"
+#include "SpscQueue.h"
+#include "NoteEvent.h"
+#include "TimingWheel.h"
+#include "NoteTable.h"
+#include "PanTable.h"
+#include "MasterVolume.h"
+#include "TransportClock.h"
 
-#define CHANNEL_NUMBER 16
-#define QUEUE_LENGTH 128
-#define SAMPLE_RATE 48000
+// Default configuration of ToneSheduler<>, can be set by the build
+#ifndef SYNTH_VOICES
+#define SYNTH_VOICES 16         // at most 32, active voices are tracked in a bitmask
+#endif
+#ifndef SYNTH_BLOCK_FRAMES
+#define SYNTH_BLOCK_FRAMES 512  // frames that are mixed at once, one DMA buffer
+#endif
+#ifndef SYNTH_OUTPUT_FORMAT
+#define SYNTH_OUTPUT_FORMAT DAC_FORMAT_STEREO32 // DAC_FORMAT_PACKED16 halves the DMA buffers
+#endif
+#ifndef SYNTH_BUFFERS
+#define SYNTH_BUFFERS 2         // DMA buffers, latency is up to SYNTH_BUFFERS blocks
+#endif
+#ifndef SYNTH_SAMPLE_RATE
+#define SYNTH_SAMPLE_RATE 48000
+#endif
 
-struct AdsrProfile
+#define QUEUE_LENGTH 128 // has to be a power of two
+#define ENVELOPE_NUMBER 16
+#define MAX_STARTS_PER_BLOCK 32
+#define FADE_NUMBER 4       // voices that can fade out at the same time after being stolen
+
+enum VoiceStealPolicy
 {
-    uint32_t attackRate;
-    uint32_t decayRate;
-    uint32_t sustainFactor;
-    uint32_t releaseRate;
+    STEAL_NONE = 0,         // wait until a voice is free
+    STEAL_OLDEST,           // voice that was started first
+    STEAL_QUIETEST,         // voice with the lowest current envelope volume
+    STEAL_SAME_PITCH,       // retrigger a voice with the same pitch, else the oldest
+    STEAL_RELEASED_FIRST    // quietest voice in its release phase, else the oldest
+};
 
-    AdsrProfile(float attack, float decay, float sustain, float release)
-    {
-        attackRate = __INT32_MAX__/(SAMPLE_RATE*attack);
-        sustainFactor = __INT32_MAX__ * decay;
-        decayRate = (__INT32_MAX__ - sustainFactor)/(SAMPLE_RATE*decay);
-        releaseRate = sustainFactor/(SAMPLE_RATE * release);
-    }
+struct VoiceStats
+{
+    uint32_t steals;            // voices taken over by a new note
+    uint32_t stalls;            // note starts deferred to the next block, no voice was free
+    uint32_t drops;             // deferred notes that were lost, the timing wheel was full
+    uint32_t maxStartDelay;     // latest start of a note in samples
+    uint8_t peakVoices;         // maximum number of voices playing at the same time
 };
 
-struct ToneJob
+// Envelope rates in volume steps per sample at SampleRate
+template <uint32_t SampleRate>
+struct BasicAdsrProfile
 {
-    Tone tone;
-    uint32_t startTime;
+    uint32_t attackRate = 0;
+    uint32_t decayRate = 0;
+    uint32_t sustainFactor = 0;
+    uint32_t releaseRate = 0;
 
-    ToneJob(Tone tone, uint32_t startTime)
+    constexpr BasicAdsrProfile() = default;
+    // Times in seconds, sustain as a fraction of full volume. A time of 0 jumps to the
+    // next level within one sample.
+    constexpr BasicAdsrProfile(float attack, float decay, float sustain, float release)
     {
-        this->tone = tone;
-        this->startTime = startTime;
+        sustainFactor = __INT32_MAX__ * sustain;
+        attackRate = attack > 0 ? __INT32_MAX__/(SampleRate*attack) : __INT32_MAX__;
+        decayRate = decay > 0 ? (__INT32_MAX__ - sustainFactor)/(SampleRate*decay) : __INT32_MAX__;
+        releaseRate = release > 0 ? sustainFactor/(SampleRate * release) : __INT32_MAX__;
     }
+
+    bool operator==(const BasicAdsrProfile&) const = default;
 };
 
+typedef BasicAdsrProfile<SYNTH_SAMPLE_RATE> AdsrProfile;
+
+//***************************************************************************************
+//* Mixes up to Voices tones into the DAC in blocks of BlockFrames stereo frames
+//*
+//* Every note has its own pan position, the voices are summed into separate left and
+//* right channels.
+//*
+//* The DAC plays a ring of Buffers blocks, free ones are filled ahead as soon as
+//* cyclicHandler runs. Format has to match the format the DAC was set up with.
+//*
+//* All sizes are template parameters, so the buffers are allocated statically and the
+//* loop bounds are known at compile time. The implementation is in ToneSheduler.tpp.
+//***************************************************************************************
+template <uint32_t Voices = SYNTH_VOICES, uint32_t BlockFrames = SYNTH_BLOCK_FRAMES, uint32_t SampleRate = SYNTH_SAMPLE_RATE,
+          uint32_t Buffers = SYNTH_BUFFERS, DACFormat Format = SYNTH_OUTPUT_FORMAT>
 class ToneSheduler {
     public:
+        typedef BasicAdsrProfile<SampleRate> Profile;
+
+        static const uint32_t VOICES = Voices;
+        static const uint32_t BLOCK_FRAMES = BlockFrames;
+        static const uint32_t BUFFERS = Buffers;
+        static const uint32_t WORDS_PER_FRAME = Format == DAC_FORMAT_PACKED16 ? 1 : 2;
+        static const uint32_t SAMPLE_RATE = SampleRate;
+
         ToneSheduler();
         ~ToneSheduler();
 
-        int addToneAbs(float frequency, float startTime_sec, float duration, AdsrProfile adsrProfile);
-        int addToneRel(float frequency, float startOffset_sec, float duration, AdsrProfile adsrProfile);
+        int addToneAbs(float frequency, float startTime_sec, float duration, Profile adsrProfile, uint8_t velocity = 127);
+        int addToneRel(float frequency, float startOffset_sec, float duration, Profile adsrProfile, uint8_t velocity = 127);
+        int addNoteAbs(uint8_t note, uint32_t startTime_sam, uint32_t duration_sam, uint8_t envelopeId, uint8_t velocity = 127, uint8_t fineTune = 0, uint8_t pan = PAN_CENTER);
+        int addNoteRel(uint8_t note, uint32_t startOffset_sam, uint32_t duration_sam, uint8_t envelopeId, uint8_t velocity = 127, uint8_t fineTune = 0, uint8_t pan = PAN_CENTER);
+        int loadEnvelopes(const Profile* profiles, uint32_t count);
         void cyclicHandler();
         bool busy();
         void stopAll();
         uint32_t getPlaceLeftInQueue();
 
+        void setVoiceStealPolicy(VoiceStealPolicy policy) { stealPolicy = policy; }
+        VoiceStealPolicy getVoiceStealPolicy() { return stealPolicy; }
+        VoiceStats getVoiceStats() { return voiceStats; }
+        uint32_t getLatencyUs() { return dac->getLatencyUs(); }
+        uint32_t getSampleTime() { return currentTime; }
+        uint8_t getActiveVoices() { return __builtin_popcount(activeVoices); }
+        // highest output level of the last block per channel
+        uint32_t getPeakLeft() { return peakLeft; }
+        uint32_t getPeakRight() { return peakRight; }
+        void resetVoiceStats();
+
+        // Converts song times in µs to samples, integer only
+        static uint32_t microsToSamples(uint32_t time_us)
+        {
+            return ((uint64_t)time_us * MICROS_TO_SAMPLES) >> 32;
+        }
+
     private:
+        static_assert(Voices >= 1 && Voices <= 32, "Active voices are tracked in a 32 bit mask");
+        static_assert(FADE_NUMBER <= 32, "Fading voices are tracked in a 32 bit mask");
+        static_assert(BlockFrames > 0, "Blocks need at least one frame");
+        static_assert(Buffers >= 2 && Buffers <= 32, "The DAC needs 2 to 32 buffers");
+
+        static const uint32_t ALL_VOICES = Voices == 32 ? UINT32_MAX : (1u << Voices) - 1;
+        static const uint32_t DECLICK_FRAMES = SampleRate / 500; // fade out time of a stolen voice (2 ms)
+        static const uint32_t OUTPUT_BUFFER_SIZE = Buffers * BlockFrames * WORDS_PER_FRAME; // blocks of stereo frames
+        static const uint64_t MICROS_TO_SAMPLES = ((uint64_t)SampleRate << 32) / 1000000; // 32.32 fixed point
+
         void fillBufferCallback(volatile uint32_t* buffer, uint32_t bufferLength);
-        bool startTone(Tone tone);
-        void handleDoneTone(uint8_t channel);
-        int addToneRaw(float frequency, uint32_t startTime_sam, float duration, AdsrProfile adsrProfile);
+        bool startTone(const NoteEvent& event, uint32_t startTime);
+        int findVoiceToSteal(const NoteEvent& event);
+        void fadeOutVoice(uint8_t channel);
+        void renderVoices(int32_t* accum, uint32_t frames);
+        void applyMasterGain();
+        void releaseDoneVoices();
+        int addToneRaw(float frequency, uint32_t startTime_sam, float duration, Profile adsrProfile, uint8_t velocity);
+        int pushEvent(uint32_t stepSize, uint32_t startTime_sam, uint32_t duration_sam, uint8_t envelopeIdx, uint8_t velocity, uint8_t pan);
+        int getEnvelopeIdx(const Profile& adsrProfile);
+
+        Tone currentTones[Voices];
+        uint32_t voiceStartTimes[Voices] = {0};
+        uint32_t activeVoices = 0; // bit n is set while currentTones[n] is playing
+
+        Tone fadingTones[FADE_NUMBER];
+        uint8_t nextFadingTone = 0;
+        uint32_t activeFadingTones = 0;
 
-        Tone currentTones[CHANNEL_NUMBER];
-        int8_t highestActiveChannel = -1;
+        VoiceStealPolicy stealPolicy = STEAL_RELEASED_FIRST;
+        VoiceStats voiceStats = {};
 
-        std::queue<ToneJob> jobQueue;
-        uint32_t placeLeftInQueue = QUEUE_LENGTH;
+        int32_t mixBuffer[2 * BlockFrames]; // interleaved left and right sums
+        uint32_t masterGain = MASTER_GAIN_UNITY; // gain at the end of the last block
+        uint32_t peakLeft = 0;
+        uint32_t peakRight = 0;
+
+        // ring of blocks played by the DAC, played ones are filled again
+        volatile uint32_t outputBuffer[OUTPUT_BUFFER_SIZE];
+
+        // written by the producer only, read-only for the consumer once an event refers to it
+        Profile envelopes[ENVELOPE_NUMBER];
+        uint8_t envelopeCount = 0;
+
+        // new jobs from the producer, sorted into the timing wheel by the consumer
+        SpscQueue<NoteEvent, QUEUE_LENGTH> jobQueue;
+        TimingWheel<BlockFrames> jobWheel;
+        NoteEvent dueJobs[MAX_STARTS_PER_BLOCK];
 
         uint32_t currentTime = 0;
 
         DAC *dac;
-};
\ No newline at end of file
+};
+
+#include "ToneSheduler.tpp"
@@ -0,0 +1,510 @@
+//***************************************************************************************
+//* Implementation of ToneSheduler, included by ToneSheduler.h
+//***************************************************************************************
+
+#pragma once
+
+#include <string.h>
+#include "Tone.h"
+#include "MixBus.h"
+
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::ToneSheduler()
+{
+    Tone::setupSine();
+    dac = &DAC::getInstance();
+    dac->start(outputBuffer, Buffers, BlockFrames * WORDS_PER_FRAME);
+}
+
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::~ToneSheduler()
+{
+    dac->stop();
+}
+
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+int ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::addToneRel(float frequency, float relStartTime_sec, float duration, Profile adsrProfile, uint8_t velocity)
+{
+    uint32_t startTime_sam = relStartTime_sec * SampleRate;
+    return addToneRaw(frequency, startTime_sam + currentTime, duration, adsrProfile, velocity);
+}
+
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+int ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::addToneAbs(float frequency, float startTime_sec, float duration, Profile adsrProfile, uint8_t velocity)
+{
+    uint32_t startTime_sam = startTime_sec * SampleRate;
+    return addToneRaw(frequency, startTime_sam, duration, adsrProfile, velocity);
+}
+
+//***************************************************************************************
+//* Adds a new tone to the dispatcher
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+int ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::addToneRaw(float frequency, uint32_t startTime_sam, float duration, Profile adsrProfile, uint8_t velocity)
+{
+
+    //parameter check
+    if (frequency < 0 || frequency > SampleRate/2)
+    {
+        return -1;
+    }
+    if (duration < 0)
+    {
+        return -3;
+    }
+
+    int envelopeIdx = getEnvelopeIdx(adsrProfile);
+    if (envelopeIdx < 0)
+    {
+        return -5;
+    }
+
+    return pushEvent(Tone::getStepSize<SampleRate>(frequency), startTime_sam, duration * SampleRate, envelopeIdx, velocity, PAN_CENTER);
+}
+
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+int ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::addNoteRel(uint8_t note, uint32_t startOffset_sam, uint32_t duration_sam, uint8_t envelopeId, uint8_t velocity, uint8_t fineTune, uint8_t pan)
+{
+    return addNoteAbs(note, startOffset_sam + currentTime, duration_sam, envelopeId, velocity, fineTune, pan);
+}
+
+//***************************************************************************************
+//* Adds a new MIDI note to the dispatcher
+//*
+//* The phase increment comes from the NoteTable and the envelope from the table set by
+//* loadEnvelopes, so unlike addTone no float math is needed. fineTune raises the note
+//* in steps of 1/FINE_TUNE_STEPS semitone, pan places it in the stereo field.
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+int ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::addNoteAbs(uint8_t note, uint32_t startTime_sam, uint32_t duration_sam, uint8_t envelopeId, uint8_t velocity, uint8_t fineTune, uint8_t pan)
+{
+    //parameter check
+    if (!NoteTable<SampleRate>::isPlayable(note, fineTune))
+    {
+        return -1;
+    }
+    if (envelopeId >= envelopeCount)
+    {
+        return -6;
+    }
+
+    return pushEvent(NoteTable<SampleRate>::getStepSize(note, fineTune), startTime_sam, duration_sam, envelopeId, velocity, pan);
+}
+
+//***************************************************************************************
+//* Puts a checked note into the job queue
+//*
+//* Producer side of the job queue, may run on another core than cyclicHandler
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+int ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::pushEvent(uint32_t stepSize, uint32_t startTime_sam, uint32_t duration_sam, uint8_t envelopeIdx, uint8_t velocity, uint8_t pan)
+{
+    //check if the queue is full
+    if (jobQueue.placeLeft() == 0)
+    {
+        return -4;
+    }
+
+    //add the tone to the queue
+    NoteEvent event;
+    event.stepSize = stepSize;
+    event.startTime = startTime_sam;
+    event.duration = duration_sam;
+    event.envelopeIdx = envelopeIdx;
+    event.velocity = velocity;
+    event.pan = pan;
+
+    jobQueue.push(event);
+    return 0;
+}
+
+//***************************************************************************************
+//* Returns the index of the profile in the envelope table, adds it if it is new
+//*
+//* Entries are never changed once added, so the consumer can read them without locking
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+int ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::getEnvelopeIdx(const Profile& adsrProfile)
+{
+    for (uint8_t i = 0; i < envelopeCount; i++)
+    {
+        if (envelopes[i] == adsrProfile)
+        {
+            return i;
+        }
+    }
+
+    if (envelopeCount == ENVELOPE_NUMBER)
+    {
+        return -1;
+    }
+
+    envelopes[envelopeCount] = adsrProfile;
+    return envelopeCount++;
+}
+
+//***************************************************************************************
+//* Replaces the envelope table, the index in profiles is the envelope id of addNote
+//*
+//* Meant to be called once when a song is loaded, before its notes are queued. Notes
+//* that are still pending play with the envelope that has their id afterwards.
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+int ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::loadEnvelopes(const Profile* profiles, uint32_t count)
+{
+    if (count > ENVELOPE_NUMBER)
+    {
+        return -5;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        envelopes[i] = profiles[i];
+    }
+    envelopeCount = count;
+    return 0;
+}
+
+//***************************************************************************************
+//* Starts the tone of event on a free voice, steals one according to the policy if
+//* all are busy
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+bool ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::startTone(const NoteEvent& event, uint32_t startTime)
+{
+    const Profile& adsrProfile = envelopes[event.envelopeIdx];
+    Tone tone = Tone(event.stepSize, event.duration,
+        adsrProfile.attackRate, adsrProfile.decayRate, adsrProfile.sustainFactor, adsrProfile.releaseRate, event.pan, event.velocity);
+
+    //find a free channel, voices that finished within this block are only released on demand
+    uint32_t freeVoices = ~activeVoices & ALL_VOICES;
+    if (freeVoices == 0)
+    {
+        releaseDoneVoices();
+        freeVoices = ~activeVoices & ALL_VOICES;
+    }
+
+    int channelIndex;
+    bool retrigger = false;
+    if (freeVoices != 0)
+    {
+        channelIndex = __builtin_ctz(freeVoices);
+    }
+    else
+    {
+        channelIndex = findVoiceToSteal(event);
+        if (channelIndex < 0)
+        {
+            voiceStats.stalls++;
+            return false;
+        }
+        voiceStats.steals++;
+
+        // a voice with the same pitch continues with the new envelope, others are faded out
+        retrigger = currentTones[channelIndex].getPhaseStep() == event.stepSize;
+        if (!retrigger)
+        {
+            fadeOutVoice(channelIndex);
+        }
+    }
+
+    // start the tone on the channel
+    if (retrigger)
+    {
+        currentTones[channelIndex].retrigger(tone);
+    }
+    else
+    {
+        currentTones[channelIndex] = tone;
+    }
+    voiceStartTimes[channelIndex] = startTime;
+    activeVoices |= 1u << channelIndex;
+
+    // statistics
+    voiceStats.maxStartDelay = MAX(voiceStats.maxStartDelay, startTime - event.startTime);
+    voiceStats.peakVoices = MAX(voiceStats.peakVoices, __builtin_popcount(activeVoices));
+
+    return true;
+}
+
+//***************************************************************************************
+//* Selects the voice that is taken over by event, -1 if none should be stolen
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+int ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::findVoiceToSteal(const NoteEvent& event)
+{
+    int oldest = __builtin_ctz(activeVoices);
+    int quietest = oldest;
+    int quietestReleased = -1;
+    int samePitch = -1;
+
+    for (uint32_t voices = activeVoices; voices; voices &= voices - 1)
+    {
+        const int channel = __builtin_ctz(voices);
+        Tone &tone = currentTones[channel];
+
+        // compare relative to the oldest start time, so the sample counter may wrap
+        if (voiceStartTimes[channel] - voiceStartTimes[oldest] > UINT32_MAX / 2)
+        {
+            oldest = channel;
+        }
+        if (tone.getVolume() < currentTones[quietest].getVolume())
+        {
+            quietest = channel;
+        }
+        if (tone.isReleased() && (quietestReleased < 0 || tone.getVolume() < currentTones[quietestReleased].getVolume()))
+        {
+            quietestReleased = channel;
+        }
+        if (tone.getPhaseStep() == event.stepSize)
+        {
+            samePitch = channel;
+        }
+    }
+
+    switch (stealPolicy)
+    {
+    case STEAL_OLDEST:
+        return oldest;
+    case STEAL_QUIETEST:
+        return quietest;
+    case STEAL_SAME_PITCH:
+        return samePitch >= 0 ? samePitch : oldest;
+    case STEAL_RELEASED_FIRST:
+        return quietestReleased >= 0 ? quietestReleased : oldest;
+    case STEAL_NONE:
+    default:
+        return -1;
+    }
+}
+
+//***************************************************************************************
+//* Moves the tone of channel to a fading slot, where it is faded out within
+//* DECLICK_FRAMES instead of being cut off
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+void ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::fadeOutVoice(uint8_t channel)
+{
+    Tone &fadingTone = fadingTones[nextFadingTone];
+    activeFadingTones |= 1u << nextFadingTone;
+    nextFadingTone = (nextFadingTone + 1) % FADE_NUMBER;
+
+    fadingTone = currentTones[channel];
+    fadingTone.fadeOut(DECLICK_FRAMES);
+}
+
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+void ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::resetVoiceStats()
+{
+    voiceStats = {};
+}
+
+//***************************************************************************************
+//* Adds the next frames stereo frames of all playing voices to accum
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+void ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::renderVoices(int32_t* accum, uint32_t frames)
+{
+    for (uint32_t voices = activeVoices; voices; voices &= voices - 1)
+    {
+        currentTones[__builtin_ctz(voices)].renderBlock(accum, frames);
+    }
+    for (uint32_t voices = activeFadingTones; voices; voices &= voices - 1)
+    {
+        fadingTones[__builtin_ctz(voices)].renderBlock(accum, frames);
+    }
+}
+
+//***************************************************************************************
+//* Applies the master volume to the mix buffer
+//*
+//* The gain set by the UI core is read once per block. A change is ramped linearly
+//* over the block, so the steps of the volume buttons don't cause zipper noise.
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+void ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::applyMasterGain()
+{
+    const uint32_t targetGain = MasterVolume::getInstance().getGain();
+    if (targetGain == masterGain)
+    {
+        if (masterGain != MASTER_GAIN_UNITY)
+        {
+            for (uint32_t i = 0; i < 2 * BlockFrames; i++)
+            {
+                mixBuffer[i] = MasterVolume::scale(mixBuffer[i], masterGain);
+            }
+        }
+        return;
+    }
+
+    // the gain with 14 more fractional bits, so slow ramps don't round to a step of 0
+    const uint32_t RAMP_SHIFT = 14;
+    int32_t gain = masterGain << RAMP_SHIFT;
+    const int32_t step = ((int32_t)(targetGain - masterGain) << RAMP_SHIFT) / (int32_t)BlockFrames;
+    for (uint32_t i = 0; i < BlockFrames; i++)
+    {
+        gain += step;
+        mixBuffer[2*i] = MasterVolume::scale(mixBuffer[2*i], gain >> RAMP_SHIFT);
+        mixBuffer[2*i + 1] = MasterVolume::scale(mixBuffer[2*i + 1], gain >> RAMP_SHIFT);
+    }
+    masterGain = targetGain;
+}
+
+//***************************************************************************************
+//* Removes the voices that finished from the active masks
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+void ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::releaseDoneVoices()
+{
+    for (uint32_t voices = activeVoices; voices; voices &= voices - 1)
+    {
+        const int channel = __builtin_ctz(voices);
+        if (currentTones[channel].isDone())
+        {
+            activeVoices &= ~(1u << channel);
+        }
+    }
+    for (uint32_t voices = activeFadingTones; voices; voices &= voices - 1)
+    {
+        const int fade = __builtin_ctz(voices);
+        if (fadingTones[fade].isDone())
+        {
+            activeFadingTones &= ~(1u << fade);
+        }
+    }
+}
+
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+void ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::cyclicHandler()
+{
+    volatile uint32_t *buffer;
+    uint32_t bufferLength;
+
+    // fill all free buffers, so the DAC is ahead as far as configured
+    while (dac->cyclicHandler(&buffer, &bufferLength))
+    {
+        //gpio_xor_mask(USE_DEBUG_PINS<<DEBUG3_PIN);
+        fillBufferCallback(buffer, bufferLength);
+        dac->bufferReady(buffer);
+
+        // the block that was just filled becomes audible once the DAC gets to it
+        TransportClock::getInstance().publish(currentTime - BlockFrames, SampleRate, dac->getPlayStartUs(buffer));
+        //gpio_xor_mask(USE_DEBUG_PINS<<DEBUG3_PIN);
+    }
+}
+
+//***************************************************************************************
+//* Releases all playing tones and drops the pending jobs
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+void ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::stopAll()
+{
+    jobQueue.clear();
+    jobWheel.clear();
+
+    for (uint32_t voices = activeVoices; voices; voices &= voices - 1)
+    {
+        currentTones[__builtin_ctz(voices)].stop();
+    }
+}
+
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+bool ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::busy()
+{
+    return !jobQueue.empty() || !jobWheel.empty() || activeVoices != 0;
+}
+
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+void ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::fillBufferCallback(volatile uint32_t* buffer, uint32_t bufferLength)
+{
+    // the DAC plays our buffers, so every one holds exactly one block of stereo frames
+    (void)bufferLength;
+    const uint32_t blockEnd = currentTime + BlockFrames;
+
+    // Sort the new jobs into the timing wheel, late ones go to the current block
+    while (!jobQueue.empty() && !jobWheel.full())
+    {
+        jobWheel.insert(jobQueue.front(), jobWheel.getBlock(currentTime));
+        jobQueue.pop();
+    }
+
+    // Jobs that start in this block, sorted by start time, the wheel keeps the ones beyond
+    // MAX_STARTS_PER_BLOCK for the next block
+    const uint32_t dueCount = jobWheel.popDue(currentTime, blockEnd, dueJobs, MAX_STARTS_PER_BLOCK);
+
+    // Idle fast path: nothing plays or starts, the DAC outputs zeros for this block. This
+    // only shortens the wake time, the main loop sleeps in __wfi until the next block.
+    if (dueCount == 0 && activeVoices == 0 && activeFadingTones == 0)
+    {
+        dac->playSilence(buffer);
+        peakLeft = 0;
+        peakRight = 0;
+        masterGain = MasterVolume::getInstance().getGain(); // nothing to ramp in silence
+        currentTime += BlockFrames;
+        return;
+    }
+
+    memset(mixBuffer, 0, sizeof(mixBuffer));
+
+    // Render the voices in sections between the start times of the jobs, so every
+    // job still starts at its exact sample
+    uint32_t rendered = 0;
+    uint32_t job = 0;
+    while (rendered < BlockFrames)
+    {
+        // Start all jobs that are due at this point of the block
+        while (job < dueCount && dueJobs[job].startTime <= currentTime + rendered)
+        {
+            if (!startTone(dueJobs[job], currentTime + rendered))
+            {
+                // no free channel, retry with the next block
+                if (!jobWheel.insert(dueJobs[job], jobWheel.getBlock(blockEnd)))
+                {
+                    voiceStats.drops++;
+                }
+            }
+            job++;
+        }
+
+        // Render until the next job has to be started or the block is full
+        uint32_t sectionEnd = job < dueCount ? dueJobs[job].startTime - currentTime : BlockFrames;
+
+        renderVoices(&mixBuffer[2 * rendered], sectionEnd - rendered);
+        rendered = sectionEnd;
+    }
+
+    applyMasterGain();
+
+    // fill the stereo buffer, the soft clip brings the bus to the output level
+    uint32_t blockPeakLeft = 0;
+    uint32_t blockPeakRight = 0;
+    for (uint32_t i = 0; i < BlockFrames; i++)
+    {
+        const int32_t left = softClip(mixBuffer[2*i]);
+        const int32_t right = softClip(mixBuffer[2*i + 1]);
+        blockPeakLeft = MAX(blockPeakLeft, (uint32_t)(left < 0 ? -left : left));
+        blockPeakRight = MAX(blockPeakRight, (uint32_t)(right < 0 ? -right : right));
+
+        if constexpr (Format == DAC_FORMAT_PACKED16)
+        {
+            buffer[i] = ((uint32_t)left & 0xFFFF0000) | ((uint32_t)right >> 16);
+        }
+        else
+        {
+            buffer[2*i] = left;
+            buffer[2*i + 1] = right;
+        }
+    }
+    peakLeft = blockPeakLeft;
+    peakRight = blockPeakRight;
+    currentTime += BlockFrames;
+
+    // clean up done tones
+    releaseDoneVoices();
+}
+
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers, DACFormat Format>
+uint32_t ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format>::getPlaceLeftInQueue()
+{
+    return jobQueue.placeLeft();
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+//***************************************************************************************
+//* Sample clock of the audio engine, shared with the UI core
+//*
+//* Core 0 publishes once per block which sample of its 64 bit timeline becomes audible
+//* at which time_us_64. A sequence counter makes the pair tear-free without a lock:
+//* it is odd while the writer updates the words, a reader that saw it change retries.
+//* The published sample count only increases. Between blocks a reader can interpolate
+//* the current position from the time.
+//***************************************************************************************
+class TransportClock
+{
+    public:
+        struct Snapshot
+        {
+            uint64_t samples;   // sample of the engine timeline ...
+            uint64_t timeUs;    // ... that is audible at this time_us_64
+            uint32_t sampleRate;
+        };
+
+        static TransportClock& getInstance()
+        {
+            static TransportClock theOneToRuleThemAll;
+            return theOneToRuleThemAll;
+        }
+
+        // ** Audio side **
+        // sampleTime is the 32 bit sample counter of the engine, it is extended to 64 bit
+        void publish(uint32_t sampleTime, uint32_t sampleRate, uint64_t timeUs)
+        {
+            const uint64_t samples = lastSamples + (uint32_t)(sampleTime - (uint32_t)lastSamples);
+            lastSamples = samples;
+
+            const uint32_t seq = sequence.load(std::memory_order_relaxed);
+            sequence.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            words[0].store((uint32_t)samples, std::memory_order_relaxed);
+            words[1].store((uint32_t)(samples >> 32), std::memory_order_relaxed);
+            words[2].store((uint32_t)timeUs, std::memory_order_relaxed);
+            words[3].store((uint32_t)(timeUs >> 32), std::memory_order_relaxed);
+            words[4].store(sampleRate, std::memory_order_relaxed);
+            sequence.store(seq + 2, std::memory_order_release);
+        }
+
+        // ** Any core **
+        Snapshot read() const
+        {
+            Snapshot snapshot;
+            uint32_t before;
+            uint32_t after;
+            do
+            {
+                before = sequence.load(std::memory_order_acquire);
+                snapshot.samples = words[0].load(std::memory_order_relaxed) | (uint64_t)words[1].load(std::memory_order_relaxed) << 32;
+                snapshot.timeUs = words[2].load(std::memory_order_relaxed) | (uint64_t)words[3].load(std::memory_order_relaxed) << 32;
+                snapshot.sampleRate = words[4].load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                after = sequence.load(std::memory_order_relaxed);
+            } while (before != after || (before & 1));
+            return snapshot;
+        }
+
+        // Sample that is audible at nowUs, interpolated from the last published block
+        uint64_t getSamplesAt(uint64_t nowUs) const
+        {
+            const Snapshot snapshot = read();
+            const int64_t elapsedUs = (int64_t)(nowUs - snapshot.timeUs);
+            const int64_t offset = elapsedUs * snapshot.sampleRate / 1000000;
+            return offset < 0 && (uint64_t)-offset > snapshot.samples ? 0 : snapshot.samples + offset;
+        }
+
+        uint32_t getSampleRate() const { return words[4].load(std::memory_order_relaxed); }
+
+    private:
+        TransportClock() {}
+
+        std::atomic<uint32_t> sequence = 0;
+        std::atomic<uint32_t> words[5] = {}; // samples, timeUs (low, high) and sampleRate
+
+        uint64_t lastSamples = 0; // writer only
+};
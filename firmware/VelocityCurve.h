@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+#define VELOCITY_STEPS 128
+#define VELOCITY_GAIN_SHIFT 15 // gains are fixed point with this many fractional bits
+
+//***************************************************************************************
+//* Gain of a note for its MIDI velocity (1 quietest, 127 full volume, 0 silent)
+//*
+//* The gain follows the square of the velocity, which spans about 42 dB and is what
+//* most synthesizers use. The table is generated by the compiler like the NoteTable.
+//***************************************************************************************
+class VelocityCurve
+{
+    public:
+        constexpr VelocityCurve()
+        {
+            for (uint32_t velocity = 0; velocity < VELOCITY_STEPS; velocity++)
+            {
+                const double level = (double)velocity / (VELOCITY_STEPS - 1);
+                gains[velocity] = (uint16_t)(level * level * (1 << VELOCITY_GAIN_SHIFT) + 0.5);
+            }
+        }
+
+        constexpr uint16_t operator[](uint8_t velocity) const
+        {
+            return gains[velocity < VELOCITY_STEPS ? velocity : VELOCITY_STEPS - 1];
+        }
+
+    private:
+        uint16_t gains[VELOCITY_STEPS] = {};
+};
+
+inline constexpr VelocityCurve velocityCurve;
@@ -0,0 +1,217 @@
+//***************************************************************************************
+//* Checks of the display driver and its transfer queue on the fake interface
+
+//* Every check prints what went wrong, the exit code is the number of failed checks so
+//* ctest reports them
+
+//***************************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ili9488_if_fake.h"
+#include "ili9488_driver.h"
+#include "ili9488_font.h"
+#include "ili9488_queue.h"
+#include "ili9488_glyph_cache.h"
+
+static uint32_t failures = 0;
+
+#define CHECK(condition)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if (!(condition))                                                       \
+        {                                                                       \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+#define ARENA_PIXELS (ILI9488_QUEUE_ARENA_SIZE / 2U)
+
+static const ili9488_rgb_t RED = {255, 0, 0};
+static const ili9488_rgb_t YELLOW = {255, 255, 0};
+static const ili9488_rgb_t NAVY = {0, 0, 80};
+
+static uint16_t expected[ILI9488_DISPLAY_SIZE_PAGE][ILI9488_DISPLAY_SIZE_COLUMN];
+
+//***************************************************************************************
+//* A fill reaches exactly the pixels of its rectangle
+//***************************************************************************************
+static void testFillRectangle(void)
+{
+    fake_if_reset();
+
+    CHECK(ili9488_driver_fill_rectangle(10, 20, 30, 40, RED) == eILI9488_OK);
+    CHECK(ili9488_queue_flush() == eILI9488_OK);
+
+    uint32_t wrong = 0;
+    for (uint32_t page = 0; page < ILI9488_DISPLAY_SIZE_PAGE; page++)
+    {
+        for (uint32_t col = 0; col < ILI9488_DISPLAY_SIZE_COLUMN; col++)
+        {
+            const bool inside = page >= 10 && page < 40 && col >= 20 && col < 60;
+            wrong += fake_gram[page][col] != (inside ? 0xF800 : 0);
+        }
+    }
+    CHECK(wrong == 0);
+    CHECK(fake_if_get_errors() == 0);
+}
+
+//***************************************************************************************
+//* A string sent in strips looks like its chars drawn one by one
+//***************************************************************************************
+static void testStringMatchesChars(void)
+{
+    const char *const text = "Song: sampleSong 120 BPM";
+
+    for (uint32_t font = 0; font < eILI9488_FONT_NUM_OF; font++)
+    {
+        const uint8_t width = ili9488_font_get_width((ili9488_font_opt_t)font);
+
+        fake_if_reset();
+        for (uint32_t i = 0; i < strlen(text) && (10 + (i + 1) * width) <= ILI9488_DISPLAY_SIZE_PAGE; i++)
+        {
+            CHECK(ili9488_driver_set_char(text[i], 10 + i * width, 100, YELLOW, NAVY, (ili9488_font_opt_t)font) == eILI9488_OK);
+        }
+        CHECK(ili9488_queue_flush() == eILI9488_OK);
+        memcpy(expected, fake_gram, sizeof(expected));
+
+        fake_if_reset();
+        CHECK(ili9488_driver_set_string(text, 10, 100, YELLOW, NAVY, (ili9488_font_opt_t)font) == eILI9488_OK);
+        CHECK(ili9488_queue_flush() == eILI9488_OK);
+
+        CHECK(fake_gram[10][100] != 0);
+        CHECK(memcmp(expected, fake_gram, sizeof(expected)) == 0);
+        CHECK(fake_if_get_errors() == 0);
+    }
+}
+
+//***************************************************************************************
+//* Parameters longer than the SPI FIFO are split across segments in order
+//***************************************************************************************
+static void testLongCommand(void)
+{
+    uint8_t params[ILI9488_QUEUE_MAX_PARAMS];
+    const uint8_t *sent;
+
+    fake_if_reset();
+    for (uint32_t i = 0; i < ILI9488_QUEUE_MAX_PARAMS; i++)
+    {
+        params[i] = 0x40 + i;
+    }
+
+    CHECK(ili9488_queue_push_command(eILI9488_SET_POS_GAMMA_CTRL_CMD, params, ILI9488_QUEUE_MAX_PARAMS) == eILI9488_OK);
+    CHECK(ili9488_queue_flush() == eILI9488_OK);
+
+    CHECK(fake_if_get_params(eILI9488_SET_POS_GAMMA_CTRL_CMD, &sent) == ILI9488_QUEUE_MAX_PARAMS);
+    CHECK(memcmp(params, sent, ILI9488_QUEUE_MAX_PARAMS) == 0);
+    CHECK(fake_if_get_errors() == 0);
+}
+
+//***************************************************************************************
+//* A stalled transfer makes pushes, waits and flushes fail instead of hanging
+//***************************************************************************************
+static void testStallTimeouts(void)
+{
+    uint32_t pushed = 0;
+
+    fake_if_reset();
+    fake_if_set_stalled(true);
+
+    while (pushed <= ILI9488_QUEUE_LENGTH && ili9488_queue_push_fill(0x1234, 100) == eILI9488_OK)
+    {
+        pushed++;
+    }
+    CHECK(pushed == ILI9488_QUEUE_LENGTH);
+    CHECK(ili9488_queue_wait(ili9488_queue_get_ticket()) != eILI9488_OK);
+    CHECK(ili9488_queue_flush() != eILI9488_OK);
+
+    fake_if_set_stalled(false);
+    CHECK(ili9488_queue_flush() == eILI9488_OK);
+    CHECK(fake_if_get_errors() == 0);
+}
+
+//***************************************************************************************
+//* Pixels of a failed push go back to the arena
+//***************************************************************************************
+static void testArenaRollback(void)
+{
+    fake_if_reset();
+    fake_if_set_stalled(true);
+
+    while (ili9488_queue_push_fill(0x1234, 100) == eILI9488_OK)
+    {
+    }
+
+    uint16_t *pixels = ili9488_queue_alloc(ARENA_PIXELS);
+    CHECK(pixels != NULL);
+    CHECK(ili9488_queue_push_pixels(pixels, ARENA_PIXELS) != eILI9488_OK);
+
+    fake_if_set_stalled(false);
+    CHECK(ili9488_queue_flush() == eILI9488_OK);
+
+    // the whole arena is free again
+    pixels = ili9488_queue_alloc(ARENA_PIXELS);
+    CHECK(pixels != NULL);
+    if (pixels != NULL)
+    {
+        CHECK(ili9488_queue_push_pixels(pixels, ARENA_PIXELS) == eILI9488_OK);
+    }
+    CHECK(ili9488_queue_flush() == eILI9488_OK);
+    CHECK(fake_if_get_errors() == 0);
+}
+
+#if ( ILI9488_GLYPH_CACHE_EN )
+//***************************************************************************************
+//* Repeated glyphs come from the cache, a flush that times out keeps them
+//***************************************************************************************
+static void testGlyphCache(void)
+{
+    ili9488_glyph_cache_stats_t stats;
+
+    fake_if_reset();
+    CHECK(ili9488_glyph_cache_flush() == eILI9488_OK);
+    ili9488_glyph_cache_reset_stats();
+
+    CHECK(ili9488_driver_set_string("abab", 10, 100, YELLOW, NAVY, eILI9488_FONT_16) == eILI9488_OK);
+    ili9488_glyph_cache_get_stats(&stats);
+    CHECK(stats.misses == 2);
+    CHECK(stats.hits == 2);
+
+    fake_if_set_stalled(true);
+    CHECK(ili9488_driver_set_char('a', 200, 100, YELLOW, NAVY, eILI9488_FONT_16) == eILI9488_OK);
+    CHECK(ili9488_glyph_cache_flush() != eILI9488_OK);
+    fake_if_set_stalled(false);
+    CHECK(ili9488_queue_flush() == eILI9488_OK);
+
+    ili9488_glyph_cache_reset_stats();
+    CHECK(ili9488_driver_set_string("ba", 10, 100, YELLOW, NAVY, eILI9488_FONT_16) == eILI9488_OK);
+    ili9488_glyph_cache_get_stats(&stats);
+    CHECK(stats.misses == 0);
+    CHECK(stats.hits == 2);
+    CHECK(ili9488_queue_flush() == eILI9488_OK);
+    CHECK(fake_if_get_errors() == 0);
+}
+#endif
+
+int main(void)
+{
+    CHECK(ili9488_driver_init() == eILI9488_OK);
+
+    testFillRectangle();
+    testStringMatchesChars();
+    testLongCommand();
+    testStallTimeouts();
+    testArenaRollback();
+#if ( ILI9488_GLYPH_CACHE_EN )
+    testGlyphCache();
+#endif
+
+    if (failures == 0)
+    {
+        printf("All checks passed\n");
+    }
+    return failures;
+}
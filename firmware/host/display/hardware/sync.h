@@ -0,0 +1,10 @@
+//***************************************************************************************
+//* Host stand-in for hardware/sync.h, C version for the display driver
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdint.h>
+
+static inline void __dmb(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
@@ -0,0 +1,330 @@
+//***************************************************************************************
+//* Fake ili9488 interface for host checks of the display driver
+
+//* A chain handed to ili9488_if_spi_transmit_chain is only read when it finishes,
+//* so pixels that were released too early show up as wrong pixels. Transfers finish
+//* while the caller waits in tight_loop_contents and at every third unlock, the
+//* completion interrupt is held off while the interface is locked.
+
+//***************************************************************************************
+
+#include "ili9488_if_fake.h"
+#include "ili9488_if.h"
+#include "ili9488_if_dma.h"
+#include "ili9488_queue.h"
+#include "pico/stdlib.h"
+
+#include <string.h>
+
+#define UNLOCKS_PER_COMPLETION 3
+
+uint16_t fake_gram[ILI9488_DISPLAY_SIZE_PAGE][ILI9488_DISPLAY_SIZE_COLUMN];
+
+// controller state
+static uint8_t command;
+static uint8_t params[256][FAKE_IF_MAX_PARAMS];
+static uint32_t paramCounts[256];
+static uint16_t columns[2];
+static uint16_t pages[2];
+static uint16_t column;
+static uint16_t page;
+static bool dataLine;
+
+// chain in flight
+static ili9488_if_segment_t chain[ILI9488_IF_CHAIN_SEGMENTS];
+static uint32_t chainLength;
+static bool chainBusy;
+
+static uint32_t lockDepth;
+static uint32_t unlocks;
+static bool irqPending;
+static bool inIrq;
+static bool stalled;
+static uint32_t transfers;
+static uint32_t errors;
+static uint32_t now;
+
+//***************************************************************************************
+//* Controller side of one word, a command byte or a parameter or pixel
+//***************************************************************************************
+static void writeCommand(uint8_t cmd)
+{
+    command = cmd;
+    paramCounts[cmd] = 0;
+    if (cmd == eILI9488_WRITE_MEM_CMD)
+    {
+        column = columns[0];
+        page = pages[0];
+    }
+}
+
+static void writeData(uint16_t word)
+{
+    if (command == eILI9488_WRITE_MEM_CMD || command == eILI9488_WRITE_MEM_CONT_CMD)
+    {
+        if (page < ILI9488_DISPLAY_SIZE_PAGE && column < ILI9488_DISPLAY_SIZE_COLUMN)
+        {
+            fake_gram[page][column] = word;
+        }
+        if (++column > columns[1])
+        {
+            column = columns[0];
+            page++;
+        }
+        return;
+    }
+
+    const uint32_t count = paramCounts[command]++;
+    if (count < FAKE_IF_MAX_PARAMS)
+    {
+        params[command][count] = (uint8_t)word;
+    }
+
+    // address windows take effect with their last parameter
+    if (count == 3 && (command == eILI9488_SET_COL_ADDR_CMD || command == eILI9488_SET_PAGE_ADDR_CMD))
+    {
+        uint16_t *window = command == eILI9488_SET_COL_ADDR_CMD ? columns : pages;
+        window[0] = (params[command][0] << 8) | params[command][1];
+        window[1] = (params[command][2] << 8) | params[command][3];
+    }
+}
+
+//***************************************************************************************
+//* Sends the chain in flight to the controller and raises the completion interrupt
+//***************************************************************************************
+static void finishChain(void)
+{
+    if (!chainBusy || stalled)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < chainLength; i++)
+    {
+        const ili9488_if_segment_t *segment = &chain[i];
+        dataLine = segment->dc;
+        for (uint32_t j = 0; j < segment->size; j++)
+        {
+            const uint16_t word = segment->p_data[segment->increment ? j : 0];
+            if (dataLine)
+            {
+                writeData(word);
+            }
+            else
+            {
+                writeCommand((uint8_t)word);
+            }
+        }
+    }
+    chainBusy = false;
+    irqPending = true;
+}
+
+//***************************************************************************************
+//* Runs the completion interrupt unless the interface is locked
+//***************************************************************************************
+static void deliverIrq(void)
+{
+    if (irqPending && lockDepth == 0 && !inIrq)
+    {
+        irqPending = false;
+        inIrq = true;
+        ili9488_queue_transfer_done();
+        inIrq = false;
+    }
+}
+
+void fake_if_reset(void)
+{
+    stalled = false;
+    finishChain();
+    deliverIrq();
+    memset(fake_gram, 0, sizeof(fake_gram));
+    transfers = 0;
+    errors = 0;
+}
+
+void fake_if_set_stalled(bool stall)
+{
+    stalled = stall;
+}
+
+uint32_t fake_if_get_transfers(void)
+{
+    return transfers;
+}
+
+uint32_t fake_if_get_errors(void)
+{
+    return errors;
+}
+
+uint32_t fake_if_get_params(uint8_t cmd, const uint8_t** p_params)
+{
+    *p_params = params[cmd];
+    return paramCounts[cmd];
+}
+
+// ** Pico SDK **
+
+uint32_t time_us_32(void)
+{
+    // every call is a microsecond, so timeouts end after a bounded number of polls
+    return now++;
+}
+
+void sleep_ms(uint32_t ms)
+{
+    now += ms * 1000;
+}
+
+void tight_loop_contents(void)
+{
+    finishChain();
+    deliverIrq();
+}
+
+// ** ili9488_if.h **
+
+ili9488_status_t ili9488_if_init(void)
+{
+    return eILI9488_OK;
+}
+
+void ili9488_if_set_cs(const bool state)
+{
+    (void)state;
+}
+
+void ili9488_if_set_dc(const bool state)
+{
+    dataLine = state;
+}
+
+void ili9488_if_set_reset(const bool state)
+{
+    (void)state;
+}
+
+void ili9488_if_set_led(const float brigthness)
+{
+    (void)brigthness;
+}
+
+void ili9488_if_wait_for_ready(void)
+{
+    finishChain();
+}
+
+void ili9488_if_pause_dma(void)
+{
+    ili9488_if_lock();
+}
+
+void ili9488_if_resume_dma(void)
+{
+    ili9488_if_unlock();
+}
+
+bool ili9488_if_dma_busy(void)
+{
+    return chainBusy;
+}
+
+// Blocking transfers of the register access that bypasses the queue
+ili9488_status_t ili9488_if_spi_transmit(const uint16_t * p_data, const uint32_t size, const bool incrementSrc, const bool blocking)
+{
+    (void)blocking;
+
+    if (chainBusy)
+    {
+        errors++;
+        return eILI9488_ERROR_SPI;
+    }
+    transfers++;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        const uint16_t word = p_data[incrementSrc ? i : 0];
+        if (dataLine)
+        {
+            writeData(word);
+        }
+        else
+        {
+            writeCommand((uint8_t)word);
+        }
+    }
+    return eILI9488_OK;
+}
+
+ili9488_status_t ili9488_if_spi_transmit_8b(const uint8_t * p_data, const uint32_t size)
+{
+    if (chainBusy)
+    {
+        errors++;
+        return eILI9488_ERROR_SPI;
+    }
+    transfers++;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        writeData(p_data[i]);
+    }
+    return eILI9488_OK;
+}
+
+ili9488_status_t ili9488_if_spi_receive(uint16_t * p_data, const uint32_t size)
+{
+    memset(p_data, 0, size * sizeof(*p_data));
+    return chainBusy ? eILI9488_ERROR_SPI : eILI9488_OK;
+}
+
+ili9488_status_t ili9488_if_spi_receive_8b(uint8_t * p_data, const uint32_t size)
+{
+    memset(p_data, 0, size);
+    return chainBusy ? eILI9488_ERROR_SPI : eILI9488_OK;
+}
+
+// ** ili9488_if_dma.h **
+
+void ili9488_if_lock(void)
+{
+    lockDepth++;
+}
+
+void ili9488_if_unlock(void)
+{
+    lockDepth--;
+    if (lockDepth == 0 && !inIrq)
+    {
+        if (++unlocks % UNLOCKS_PER_COMPLETION == 0)
+        {
+            finishChain();
+        }
+        deliverIrq();
+    }
+}
+
+ili9488_status_t ili9488_if_spi_transmit_chain(const ili9488_if_segment_t * p_segments, const uint32_t count)
+{
+    // the queue starts a chain only once the previous one has finished
+    if (chainBusy || count == 0 || count > ILI9488_IF_CHAIN_SEGMENTS)
+    {
+        errors++;
+        return eILI9488_ERROR_SPI;
+    }
+    for (uint32_t i = 0; i + 1 < count; i++)
+    {
+        // a longer segment would still be in the FIFO when DC changes
+        if (p_segments[i].size > ILI9488_IF_CHAIN_SEGMENT_MAX)
+        {
+            errors++;
+            return eILI9488_ERROR_SPI;
+        }
+    }
+
+    transfers++;
+    memcpy(chain, p_segments, count * sizeof(*p_segments));
+    chainLength = count;
+    chainBusy = true;
+    return eILI9488_OK;
+}
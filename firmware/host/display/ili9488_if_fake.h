@@ -0,0 +1,34 @@
+//***************************************************************************************
+//* Fake ili9488 interface for host checks of the display driver
+
+//* Replaces ili9488_if.c. Commands and pixels go into an emulated display memory
+//* instead of the SPI, so checks can compare what the controller would show.
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ili9488_regdef.h"
+
+#define FAKE_IF_MAX_PARAMS 32    // parameters kept per command
+
+// Display memory, indexed [page][column] in RGB565
+extern uint16_t fake_gram[ILI9488_DISPLAY_SIZE_PAGE][ILI9488_DISPLAY_SIZE_COLUMN];
+
+// Clears the display memory and the counters, finishes the transfer in flight
+void fake_if_reset(void);
+
+// While stalled, started transfers never finish and the caller runs into timeouts
+void fake_if_set_stalled(bool stalled);
+
+// Transfers started on the interface, blocking ones and chains
+uint32_t fake_if_get_transfers(void);
+
+// Transfers the interface refused, started while busy or not fitting the DMA chain
+uint32_t fake_if_get_errors(void);
+
+// Parameters last written to cmd, returns their number
+uint32_t fake_if_get_params(uint8_t cmd, const uint8_t** p_params);
@@ -0,0 +1,8 @@
+//***************************************************************************************
+//* Host stand-in for pico/mem_ops.h
+
+//***************************************************************************************
+
+#pragma once
+
+#include <string.h>
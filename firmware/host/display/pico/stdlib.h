@@ -0,0 +1,26 @@
+//***************************************************************************************
+//* Host stand-in for the Pico SDK's pico/stdlib.h, C version for the display driver
+
+//* tight_loop_contents is where a waiting caller lets the fake interface finish
+//* transfers, see ili9488_if_fake.c
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef unsigned int uint;
+
+uint32_t time_us_32(void);
+void sleep_ms(uint32_t ms);
+void tight_loop_contents(void);
+
+#ifndef MIN
+#define MIN(a, b) ((b) > (a) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
@@ -0,0 +1,312 @@
+//***************************************************************************************
+//* Host implementation of the HAL shim
+
+//* Emulates just enough of the RP2040 DMA, PIO, SIO FIFO and IRQ blocks to run DAC.cpp
+//* unchanged on the host.
+
+//***************************************************************************************
+
+#include "hal_host.h"
+
+#include <chrono>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "pico/multicore.h"
+
+struct DmaChannelState
+{
+    dma_channel_config config;
+    uint32_t reloadCount;
+    bool claimed;
+    bool busy;
+    bool irq0Enabled;
+};
+
+static dma_hw_t dmaHw;
+static DmaChannelState dmaChannels[NUM_DMA_CHANNELS];
+static pio_hw_t pioHw[2];
+static uint32_t claimedSm[2];
+static irq_handler_t irqHandlers[32];
+static bool irqEnabled[32];
+
+static hal_tx_sink_t txSink = nullptr;
+static void *txSinkContext = nullptr;
+
+dma_hw_t *const dma_hw = &dmaHw;
+pio_hw_t *const pio0 = &pioHw[0];
+pio_hw_t *const pio1 = &pioHw[1];
+
+static const auto startTime = std::chrono::steady_clock::now();
+
+uint64_t time_us_64()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+uint32_t time_us_32()
+{
+    return (uint32_t)time_us_64();
+}
+
+//***************************************************************************************
+//* IRQ
+//***************************************************************************************
+void irq_set_exclusive_handler(unsigned int num, irq_handler_t handler)
+{
+    irqHandlers[num] = handler;
+}
+
+void irq_set_enabled(unsigned int num, bool enabled)
+{
+    irqEnabled[num] = enabled;
+}
+
+//***************************************************************************************
+//* Inter-core FIFO
+//***************************************************************************************
+bool multicore_fifo_wready()
+{
+    return true;
+}
+
+bool multicore_fifo_rvalid()
+{
+    return false;
+}
+
+void multicore_fifo_push_blocking(uint32_t data)
+{
+    (void)data;
+    if (irqEnabled[SIO_IRQ_PROC0] && irqHandlers[SIO_IRQ_PROC0])
+    {
+        irqHandlers[SIO_IRQ_PROC0]();
+    }
+}
+
+void multicore_fifo_drain()
+{
+}
+
+void multicore_fifo_clear_irq()
+{
+}
+
+//***************************************************************************************
+//* PIO
+//***************************************************************************************
+int pio_claim_unused_sm(PIO pio, bool /*required*/)
+{
+    uint32_t &claimed = claimedSm[pio == pio0 ? 0 : 1];
+    for (int sm = 0; sm < NUM_PIO_STATE_MACHINES; sm++)
+    {
+        if (!(claimed & (1u << sm)))
+        {
+            claimed |= 1u << sm;
+            return sm;
+        }
+    }
+    return -1;
+}
+
+unsigned int pio_add_program(PIO /*pio*/, const pio_program_t * /*program*/)
+{
+    return 0;
+}
+
+unsigned int pio_get_dreq(PIO pio, unsigned int sm, bool isTx)
+{
+    return (pio == pio0 ? 0 : 8) + (isTx ? 0 : 4) + sm;
+}
+
+void hal_pio_set_tx_sink(hal_tx_sink_t sink, void *context)
+{
+    txSink = sink;
+    txSinkContext = context;
+}
+
+//***************************************************************************************
+//* DMA
+//***************************************************************************************
+int dma_claim_unused_channel(bool /*required*/)
+{
+    for (int channel = 0; channel < NUM_DMA_CHANNELS; channel++)
+    {
+        if (!dmaChannels[channel].claimed)
+        {
+            dmaChannels[channel].claimed = true;
+            return channel;
+        }
+    }
+    return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(unsigned int channel)
+{
+    dma_channel_config config;
+    config.readIncrement = true;
+    config.writeIncrement = false;
+    config.dataSize = DMA_SIZE_32;
+    config.dreq = 0x3f;
+    config.chainTo = channel;
+    return config;
+}
+
+void dma_channel_configure(unsigned int channel, const dma_channel_config *config, volatile void *writeAddr,
+                           const volatile void *readAddr, uint32_t transferCount, bool trigger)
+{
+    dmaChannels[channel].config = *config;
+    dmaHw.ch[channel].write_addr = writeAddr;
+    dmaHw.ch[channel].read_addr = readAddr;
+    dma_channel_set_trans_count(channel, transferCount, trigger);
+}
+
+void dma_channel_set_config(unsigned int channel, const dma_channel_config *config, bool trigger)
+{
+    dmaChannels[channel].config = *config;
+    if (trigger)
+    {
+        dma_channel_start(channel);
+    }
+}
+
+void dma_channel_set_read_addr(unsigned int channel, const volatile void *readAddr, bool trigger)
+{
+    dmaHw.ch[channel].read_addr = readAddr;
+    if (trigger)
+    {
+        dma_channel_start(channel);
+    }
+}
+
+void dma_channel_set_trans_count(unsigned int channel, uint32_t transferCount, bool trigger)
+{
+    dmaChannels[channel].reloadCount = transferCount;
+    dmaHw.ch[channel].transfer_count = transferCount;
+    if (trigger)
+    {
+        dma_channel_start(channel);
+    }
+}
+
+void dma_channel_start(unsigned int channel)
+{
+    // like the hardware, a trigger reloads the last written transfer count
+    dmaHw.ch[channel].transfer_count = dmaChannels[channel].reloadCount;
+    dmaChannels[channel].busy = true;
+}
+
+void dma_channel_abort(unsigned int channel)
+{
+    dmaChannels[channel].busy = false;
+}
+
+bool dma_channel_is_busy(unsigned int channel)
+{
+    return dmaChannels[channel].busy;
+}
+
+void dma_channel_set_irq0_enabled(unsigned int channel, bool enabled)
+{
+    dmaChannels[channel].irq0Enabled = enabled;
+}
+
+bool dma_channel_get_irq0_status(unsigned int channel)
+{
+    return dmaHw.ints0 & (1u << channel);
+}
+
+static bool findTxFifo(volatile void *addr, PIO *pio, uint32_t *sm)
+{
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        for (uint32_t s = 0; s < NUM_PIO_STATE_MACHINES; s++)
+        {
+            if (addr == &pioHw[i].txf[s])
+            {
+                *pio = &pioHw[i];
+                *sm = s;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+uint32_t hal_dma_step()
+{
+    int channel = -1;
+    for (int i = 0; i < NUM_DMA_CHANNELS; i++)
+    {
+        if (dmaChannels[i].busy)
+        {
+            channel = i;
+            break;
+        }
+    }
+    if (channel < 0)
+    {
+        return 0;
+    }
+
+    DmaChannelState &state = dmaChannels[channel];
+    dma_channel_hw_t &hw = dmaHw.ch[channel];
+    const uint32_t elementSize = 1u << state.config.dataSize;
+    const uint32_t count = hw.transfer_count;
+
+    PIO pio;
+    uint32_t sm;
+    bool toFifo = findTxFifo(hw.write_addr, &pio, &sm);
+
+    const volatile uint8_t *read = (const volatile uint8_t *)hw.read_addr;
+    volatile uint8_t *write = (volatile uint8_t *)hw.write_addr;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t word = 0;
+        memcpy(&word, (const void *)read, elementSize);
+        if (toFifo)
+        {
+            if (txSink)
+            {
+                txSink(txSinkContext, pio, sm, word);
+            }
+        }
+        else
+        {
+            memcpy((void *)write, &word, elementSize);
+        }
+        if (state.config.readIncrement)
+        {
+            read += elementSize;
+        }
+        if (state.config.writeIncrement)
+        {
+            write += elementSize;
+        }
+    }
+
+    // the address registers keep their end values, like on the hardware
+    hw.read_addr = read;
+    hw.write_addr = write;
+    hw.transfer_count = 0;
+    state.busy = false;
+
+    if (state.config.chainTo != (uint32_t)channel)
+    {
+        dma_channel_start(state.config.chainTo);
+    }
+
+    if (state.irq0Enabled)
+    {
+        dmaHw.ints0.value |= 1u << channel;
+        if (irqEnabled[DMA_IRQ_0] && irqHandlers[DMA_IRQ_0])
+        {
+            irqHandlers[DMA_IRQ_0]();
+        }
+    }
+
+    return count;
+}
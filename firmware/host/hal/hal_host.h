@@ -0,0 +1,21 @@
+//***************************************************************************************
+//* Host control interface of the HAL shim
+
+//* Lets host programs drive the emulated DMA and collect what the i2s PIO would
+//* have shifted out.
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdint.h>
+#include "hardware/pio.h"
+
+// Receives every word the DMA writes into a PIO TX FIFO
+typedef void (*hal_tx_sink_t)(void *context, PIO pio, uint32_t sm, uint32_t word);
+
+void hal_pio_set_tx_sink(hal_tx_sink_t sink, void *context);
+
+// Runs the currently active DMA transfer to completion, starts its chained channel
+// and raises the channel interrupt. Returns the number of transferred words.
+uint32_t hal_dma_step();
@@ -0,0 +1,12 @@
+//***************************************************************************************
+//* Host stand-in for hardware/clocks.h
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdint.h>
+
+enum clock_index { clk_sys = 5 };
+
+static inline uint32_t clock_get_hz(enum clock_index clk_index) { (void)clk_index; return 125000000; }
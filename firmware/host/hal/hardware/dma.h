@@ -0,0 +1,73 @@
+//***************************************************************************************
+//* Host stand-in for hardware/dma.h
+
+//* Channels are emulated in hal_host.cpp: a transfer runs to completion when the
+//* host calls hal_dma_step(), which also chains, raises IRQ0 and calls the handler.
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define NUM_DMA_CHANNELS 12
+
+enum dma_channel_transfer_size
+{
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2
+};
+
+typedef struct
+{
+    bool readIncrement;
+    bool writeIncrement;
+    enum dma_channel_transfer_size dataSize;
+    uint32_t dreq;
+    uint32_t chainTo;
+} dma_channel_config;
+
+// Write-1-to-clear register, like INTS0 on the RP2040
+struct io_w1c_32
+{
+    uint32_t value = 0;
+    io_w1c_32& operator=(uint32_t mask) { value &= ~mask; return *this; }
+    operator uint32_t() const { return value; }
+};
+
+struct dma_channel_hw_t
+{
+    const volatile void *read_addr;
+    volatile void *write_addr;
+    uint32_t transfer_count;
+    uint32_t ctrl_trig;
+};
+
+struct dma_hw_t
+{
+    dma_channel_hw_t ch[NUM_DMA_CHANNELS];
+    io_w1c_32 ints0;
+};
+
+extern dma_hw_t *const dma_hw;
+
+int dma_claim_unused_channel(bool required);
+dma_channel_config dma_channel_get_default_config(unsigned int channel);
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) { c->dataSize = size; }
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool incr) { c->readIncrement = incr; }
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool incr) { c->writeIncrement = incr; }
+static inline void channel_config_set_dreq(dma_channel_config *c, unsigned int dreq) { c->dreq = dreq; }
+static inline void channel_config_set_chain_to(dma_channel_config *c, unsigned int chainTo) { c->chainTo = chainTo; }
+
+void dma_channel_configure(unsigned int channel, const dma_channel_config *config, volatile void *writeAddr,
+                           const volatile void *readAddr, uint32_t transferCount, bool trigger);
+void dma_channel_set_config(unsigned int channel, const dma_channel_config *config, bool trigger);
+void dma_channel_set_read_addr(unsigned int channel, const volatile void *readAddr, bool trigger);
+void dma_channel_set_trans_count(unsigned int channel, uint32_t transferCount, bool trigger);
+void dma_channel_start(unsigned int channel);
+void dma_channel_abort(unsigned int channel);
+bool dma_channel_is_busy(unsigned int channel);
+void dma_channel_set_irq0_enabled(unsigned int channel, bool enabled);
+bool dma_channel_get_irq0_status(unsigned int channel);
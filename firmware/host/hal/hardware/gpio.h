@@ -0,0 +1,19 @@
+//***************************************************************************************
+//* Host stand-in for hardware/gpio.h
+
+//* GPIOs only drive debug pins in the audio engine, so every call is a no-op
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPIO_OUT 1
+#define GPIO_IN 0
+
+static inline void gpio_init(unsigned int gpio) { (void)gpio; }
+static inline void gpio_set_dir(unsigned int gpio, bool out) { (void)gpio; (void)out; }
+static inline void gpio_put(unsigned int gpio, bool value) { (void)gpio; (void)value; }
+static inline void gpio_xor_mask(uint32_t mask) { (void)mask; }
@@ -0,0 +1,18 @@
+//***************************************************************************************
+//* Host stand-in for hardware/irq.h
+
+//* Handlers are stored and invoked by the emulated DMA in hal_host.cpp
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdbool.h>
+
+#define DMA_IRQ_0 11
+#define DMA_IRQ_1 12
+
+typedef void (*irq_handler_t)(void);
+
+void irq_set_exclusive_handler(unsigned int num, irq_handler_t handler);
+void irq_set_enabled(unsigned int num, bool enabled);
@@ -0,0 +1,48 @@
+//***************************************************************************************
+//* Host stand-in for hardware/pio.h
+
+//* Words written to a TX FIFO are passed to the sink registered with
+//* hal_pio_set_tx_sink() instead of being shifted out on pins.
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define NUM_PIO_STATE_MACHINES 4
+
+struct pio_hw_t
+{
+    volatile uint32_t txf[NUM_PIO_STATE_MACHINES];
+};
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t *const pio0;
+extern pio_hw_t *const pio1;
+
+typedef struct
+{
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+} pio_program_t;
+
+typedef struct
+{
+    uint32_t clkdiv;
+} pio_sm_config;
+
+enum pio_fifo_join
+{
+    PIO_FIFO_JOIN_NONE = 0,
+    PIO_FIFO_JOIN_TX = 1,
+    PIO_FIFO_JOIN_RX = 2
+};
+
+int pio_claim_unused_sm(PIO pio, bool required);
+unsigned int pio_add_program(PIO pio, const pio_program_t *program);
+unsigned int pio_get_dreq(PIO pio, unsigned int sm, bool isTx);
+static inline void pio_sm_set_enabled(PIO pio, unsigned int sm, bool enabled) { (void)pio; (void)sm; (void)enabled; }
+static inline void pio_gpio_init(PIO pio, unsigned int pin) { (void)pio; (void)pin; }
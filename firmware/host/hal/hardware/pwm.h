@@ -0,0 +1,6 @@
+//***************************************************************************************
+//* Host stand-in for hardware/pwm.h
+
+//***************************************************************************************
+
+#pragma once
@@ -0,0 +1,13 @@
+//***************************************************************************************
+//* Host stand-in for hardware/sync.h
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdint.h>
+
+static inline void __dmb() { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+static inline void __wfi() {}
+static inline uint32_t save_and_disable_interrupts() { return 0; }
+static inline void restore_interrupts(uint32_t status) { (void)status; }
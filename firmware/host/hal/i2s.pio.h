@@ -0,0 +1,40 @@
+//***************************************************************************************
+//* Host stand-in for the pioasm output of i2s.pio
+
+//* The program is never executed, the DMA writes to the TX FIFO reach the host sink
+
+//***************************************************************************************
+
+#pragma once
+
+#include "hardware/pio.h"
+
+#define i2s_offset_entry_point 7u
+
+static const uint16_t i2s_program_instructions[8] = {0};
+
+static const pio_program_t i2s_program = {
+    i2s_program_instructions,
+    8,
+    -1,
+};
+
+static inline void i2s_program_init(PIO pio, unsigned int sm, unsigned int offset, unsigned int lrclkPin,
+                                    unsigned int bclkPin, unsigned int doutPin, float sampleRate)
+{
+    (void)pio; (void)sm; (void)offset; (void)lrclkPin; (void)bclkPin; (void)doutPin; (void)sampleRate;
+}
+
+static const uint16_t i2s16_program_instructions[16] = {0};
+
+static const pio_program_t i2s16_program = {
+    i2s16_program_instructions,
+    16,
+    -1,
+};
+
+static inline void i2s16_program_init(PIO pio, unsigned int sm, unsigned int offset, unsigned int lrclkPin,
+                                      unsigned int bclkPin, unsigned int doutPin, float sampleRate)
+{
+    (void)pio; (void)sm; (void)offset; (void)lrclkPin; (void)bclkPin; (void)doutPin; (void)sampleRate;
+}
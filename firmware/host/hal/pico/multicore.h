@@ -0,0 +1,23 @@
+//***************************************************************************************
+//* Host stand-in for the Pico SDK's pico/multicore.h
+
+//* The host runs everything on one thread as core 0. Words pushed into the FIFO
+//* raise the SIO interrupt right away, like the doorbell on the other core would.
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SIO_IRQ_PROC0 15
+#define SIO_IRQ_PROC1 16
+
+static inline unsigned int get_core_num() { return 0; }
+
+bool multicore_fifo_wready();
+bool multicore_fifo_rvalid();
+void multicore_fifo_push_blocking(uint32_t data);
+void multicore_fifo_drain();
+void multicore_fifo_clear_irq();
@@ -0,0 +1,29 @@
+//***************************************************************************************
+//* Host stand-in for the Pico SDK's pico/stdlib.h
+
+//* Only the parts used by the audio engine are provided
+
+//***************************************************************************************
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+typedef unsigned int uint;
+
+#include "hardware/gpio.h"
+
+uint32_t time_us_32();
+uint64_t time_us_64();
+
+static inline void tight_loop_contents() {}
+
+#ifndef MIN
+#define MIN(a, b) ((b) > (a) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
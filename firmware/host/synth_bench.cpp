@@ -0,0 +1,351 @@
+//***************************************************************************************
+//* Micro benchmarks of the audio engine
+
+//* Runs the engine on the HAL shim and reports the cost of filling one DMA block
+
+//***************************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include <math.h>
+#include <queue>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "hal_host.h"
+#include "DAC.h"
+#include "ToneSheduler.h"
+#include "MixBus.h"
+
+static const uint32_t BENCH_BLOCKS = 400;
+static const uint32_t BENCH_FRAMES = BENCH_BLOCKS * SYNTH_BLOCK_FRAMES;
+
+static inline uint64_t readCycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+//***************************************************************************************
+//* Cost of one fillBufferCallback with a given number of sounding voices
+//***************************************************************************************
+static void benchVoices(uint32_t voices)
+{
+    static ToneSheduler<> toneSheduler;
+    AdsrProfile profile = AdsrProfile(0.01, 0.1, 0.5, 0.3);
+
+    for (uint32_t i = 0; i < voices; i++)
+    {
+        toneSheduler.addToneAbs(220.0f + 20.0f * i, 0, 60, profile);
+    }
+
+    // prime the pipeline so all voices are running
+    hal_dma_step();
+    toneSheduler.cyclicHandler();
+
+    uint64_t cycles = 0;
+    for (uint32_t block = 0; block < BENCH_BLOCKS; block++)
+    {
+        hal_dma_step();
+        uint64_t start = readCycles();
+        toneSheduler.cyclicHandler();
+        cycles += readCycles() - start;
+    }
+    toneSheduler.stopAll();
+
+    const double frames = BENCH_FRAMES;
+    printf("voices %2u: %8.1f cycles/frame\n", voices, cycles / frames);
+}
+
+//***************************************************************************************
+//* Cost per frame when only the highest slots are still playing
+//*
+//* All slots are filled, then the short notes in the low slots finish, which leaves
+//* the slot array fragmented with few live voices
+//***************************************************************************************
+static void benchFragmented(uint32_t liveVoices)
+{
+    static ToneSheduler<> toneSheduler;
+    AdsrProfile shortProfile = AdsrProfile(0.001, 0.001, 0.5, 0.001);
+    AdsrProfile longProfile = AdsrProfile(0.01, 0.1, 0.5, 0.3);
+
+    for (uint32_t i = 0; i < SYNTH_VOICES - liveVoices; i++)
+    {
+        toneSheduler.addToneAbs(220.0f + 20.0f * i, 0, 0.005, shortProfile);
+    }
+    for (uint32_t i = 0; i < liveVoices; i++)
+    {
+        toneSheduler.addToneAbs(440.0f + 20.0f * i, 0.001, 60, longProfile);
+    }
+
+    // let the short notes finish
+    for (uint32_t block = 0; block < 4; block++)
+    {
+        hal_dma_step();
+        toneSheduler.cyclicHandler();
+    }
+
+    uint64_t cycles = 0;
+    for (uint32_t block = 0; block < BENCH_BLOCKS; block++)
+    {
+        hal_dma_step();
+        uint64_t start = readCycles();
+        toneSheduler.cyclicHandler();
+        cycles += readCycles() - start;
+    }
+    toneSheduler.stopAll();
+
+    const double frames = BENCH_FRAMES;
+    printf("fragmented, %2u of %u live: %8.1f cycles/frame\n", liveVoices, SYNTH_VOICES, cycles / frames);
+}
+
+//***************************************************************************************
+//* Block cost without any voice, the DAC plays the zero word instead of the buffer
+//*
+//* This is the time core 0 is awake per block between songs, it sleeps in __wfi for
+//* the rest of the block
+//***************************************************************************************
+static void benchIdle()
+{
+    static ToneSheduler<> toneSheduler;
+
+    uint64_t cycles = 0;
+    for (uint32_t block = 0; block < BENCH_BLOCKS; block++)
+    {
+        hal_dma_step();
+        uint64_t start = readCycles();
+        toneSheduler.cyclicHandler();
+        cycles += readCycles() - start;
+    }
+
+    printf("idle:      %8.0f cycles/block\n", (double)cycles / BENCH_BLOCKS);
+}
+
+//***************************************************************************************
+//* Block cost while short notes are constantly queued and started
+//***************************************************************************************
+static void benchChurn()
+{
+    static ToneSheduler<> toneSheduler;
+    AdsrProfile profile = AdsrProfile(0.002, 0.01, 0.5, 0.005);
+    float nextStart = 0;
+
+    uint64_t cycles = 0;
+    uint64_t worst = 0;
+    uint64_t best = UINT64_MAX;
+    for (uint32_t block = 0; block < BENCH_BLOCKS; block++)
+    {
+        while (toneSheduler.getPlaceLeftInQueue() > 0)
+        {
+            toneSheduler.addToneAbs(220.0f + (block % 32) * 10.0f, nextStart, 0.01, profile);
+            nextStart += 0.001f;
+        }
+
+        hal_dma_step();
+        uint64_t start = readCycles();
+        toneSheduler.cyclicHandler();
+        uint64_t blockCycles = readCycles() - start;
+
+        cycles += blockCycles;
+        worst = MAX(worst, blockCycles);
+        best = MIN(best, blockCycles);
+    }
+    toneSheduler.stopAll();
+
+    printf("churn:     %8.0f cycles/block mean, %llu min, %llu max\n", (double)cycles / BENCH_BLOCKS,
+           (unsigned long long)best, (unsigned long long)worst);
+}
+
+//***************************************************************************************
+//* Cost of a configuration with all voices sounding
+//*
+//* Reports cycles per frame and the load per second of audio, which is what has to fit
+//* into the 125 MHz of the RP2040
+//***************************************************************************************
+template <uint32_t Voices, uint32_t BlockFrames, uint32_t SampleRate, uint32_t Buffers = 2,
+          DACFormat Format = DAC_FORMAT_STEREO32>
+static void benchConfig()
+{
+    typedef ToneSheduler<Voices, BlockFrames, SampleRate, Buffers, Format> Sheduler;
+    static Sheduler toneSheduler;
+    typename Sheduler::Profile profile = typename Sheduler::Profile(0.01, 0.1, 0.5, 0.3);
+
+    for (uint32_t i = 0; i < Voices; i++)
+    {
+        toneSheduler.addToneAbs(110.0f + 20.0f * i, 0, 600, profile);
+    }
+
+    // prime the pipeline so all voices are running
+    hal_dma_step();
+    toneSheduler.cyclicHandler();
+
+    // same amount of audio for every configuration
+    const uint32_t blocks = BENCH_FRAMES / BlockFrames;
+    uint64_t cycles = 0;
+    for (uint32_t block = 0; block < blocks; block++)
+    {
+        hal_dma_step();
+        uint64_t start = readCycles();
+        toneSheduler.cyclicHandler();
+        cycles += readCycles() - start;
+    }
+    toneSheduler.stopAll();
+
+    // all buffers are queued after a refill, the DAC was set up for the default format
+    const double latency = Buffers * BlockFrames * 1e6 / SampleRate;
+
+    const double cyclesPerFrame = (double)cycles / (blocks * BlockFrames);
+    printf("config %2u voices, %2u x %4u frames, %5u Hz, %s: %8.1f cycles/frame, %7.2f Mcycles/s audio, %6.2f ms latency, %5u bytes DMA buffer\n",
+           Voices, Buffers, BlockFrames, SampleRate, Format == DAC_FORMAT_PACKED16 ? "16 bit" : "32 bit",
+           cyclesPerFrame, cyclesPerFrame * SampleRate / 1e6, latency / 1000.0,
+           Buffers * BlockFrames * Sheduler::WORDS_PER_FRAME * 4);
+}
+
+//***************************************************************************************
+//* Harmonic distortion of a sine with period samples, relative to the fundamental
+//*
+//* Sums the harmonics from firstHarmonic up to Nyquist, 2 gives the THD. The high
+//* harmonics are what makes hard clipping sound harsh.
+//***************************************************************************************
+static double harmonicDistortion(const int32_t *samples, uint32_t count, uint32_t period, uint32_t firstHarmonic)
+{
+    double fundamental = 0;
+    double harmonics = 0;
+    for (uint32_t harmonic = 1; harmonic < period / 2; harmonic++)
+    {
+        double re = 0;
+        double im = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            const double angle = 2 * M_PI * harmonic * i / period;
+            re += samples[i] * cos(angle);
+            im += samples[i] * sin(angle);
+        }
+        const double power = re * re + im * im;
+        if (harmonic == 1)
+        {
+            fundamental = power;
+        }
+        else if (harmonic >= firstHarmonic)
+        {
+            harmonics += power;
+        }
+    }
+    return sqrt(harmonics / fundamental);
+}
+
+//***************************************************************************************
+//* Distortion and cost of the soft clip compared to clipping hard at full scale
+//*
+//* A sine on the mix bus is driven from below the knee to four times full scale, the
+//* hard clip is what saturating every add did before
+//***************************************************************************************
+static void benchClipping()
+{
+    const uint32_t PERIOD = 64;
+    const uint32_t COUNT = 64 * PERIOD;
+    static int32_t bus[COUNT];
+    static int32_t soft[COUNT];
+    static int32_t hard[COUNT];
+
+    for (double drive : {0.4, 0.8, 1.0, 1.5, 2.0, 4.0})
+    {
+        const double amplitude = drive * SoftClip::FULL_SCALE;
+        for (uint32_t i = 0; i < COUNT; i++)
+        {
+            const double value = amplitude * sin(2 * M_PI * i / PERIOD);
+            bus[i] = (int32_t)value;
+            const double scaled = value * (1 << MIX_HEADROOM_BITS);
+            hard[i] = scaled > INT32_MAX ? INT32_MAX : scaled < INT32_MIN ? INT32_MIN : (int32_t)scaled;
+        }
+
+        uint64_t start = readCycles();
+        for (uint32_t i = 0; i < COUNT; i++)
+        {
+            soft[i] = softClip(bus[i]);
+        }
+        const double cycles = (double)(readCycles() - start) / COUNT;
+
+        printf("clip %.1fx full scale: THD %6.2f %% soft, %6.2f %% hard, above 7th %6.3f %% soft, %6.3f %% hard, %4.1f cycles/sample soft\n",
+               drive, 100 * harmonicDistortion(soft, COUNT, PERIOD, 2), 100 * harmonicDistortion(hard, COUNT, PERIOD, 2),
+               100 * harmonicDistortion(soft, COUNT, PERIOD, 8), 100 * harmonicDistortion(hard, COUNT, PERIOD, 8), cycles);
+    }
+}
+
+//***************************************************************************************
+//* Push/pop cost of the note event queue, std::queue as reference
+//***************************************************************************************
+template <typename Queue, typename Push, typename Pop>
+static double measureQueue(Queue &queue, Push push, Pop pop)
+{
+    const uint32_t ROUNDS = 2000;
+    const uint32_t BATCH = QUEUE_LENGTH / 2;
+    NoteEvent event = {};
+
+    uint64_t start = readCycles();
+    for (uint32_t round = 0; round < ROUNDS; round++)
+    {
+        for (uint32_t i = 0; i < BATCH; i++)
+        {
+            event.startTime = i;
+            push(queue, event);
+        }
+        for (uint32_t i = 0; i < BATCH; i++)
+        {
+            pop(queue, &event);
+        }
+    }
+    return (double)(readCycles() - start) / (ROUNDS * BATCH);
+}
+
+static void benchQueue()
+{
+    static SpscQueue<NoteEvent, QUEUE_LENGTH> ring;
+    double ringCycles = measureQueue(ring,
+        [](auto &q, const NoteEvent &e) { q.push(e); },
+        [](auto &q, NoteEvent *e) { q.pop(e); });
+
+    std::queue<NoteEvent> stdQueue;
+    double stdCycles = measureQueue(stdQueue,
+        [](auto &q, const NoteEvent &e) { q.push(e); },
+        [](auto &q, NoteEvent *e) { *e = q.front(); q.pop(); });
+
+    printf("queue:     %8.1f cycles/push+pop SpscQueue, %.1f std::queue\n", ringCycles, stdCycles);
+}
+
+int main()
+{
+    DAC::getInstance().setup(28, 27, 3, SYNTH_SAMPLE_RATE, SYNTH_OUTPUT_FORMAT);
+
+    for (uint32_t voices : {4u, 8u, 16u})
+    {
+        benchVoices(voices);
+    }
+    for (uint32_t liveVoices : {1u, 2u, 4u})
+    {
+        benchFragmented(liveVoices);
+    }
+    benchIdle();
+    benchChurn();
+    benchQueue();
+    benchClipping();
+
+    // low latency, default, low CPU
+    benchConfig<8, 64, 48000, 2>();
+    benchConfig<8, 128, 48000>();
+    benchConfig<8, 256, 48000>();
+    benchConfig<16, 128, 48000, 8>();
+    benchConfig<16, 512, 48000>();
+    benchConfig<16, 512, 48000, 2, DAC_FORMAT_PACKED16>();
+    benchConfig<32, 512, 24000>();
+    benchConfig<32, 256, 24000, 8>();
+    benchConfig<32, 1024, 24000>();
+    return 0;
+}
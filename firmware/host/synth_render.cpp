@@ -0,0 +1,246 @@
+//***************************************************************************************
+//* Offline renderer for the compiled-in song
+
+//* Plays the song through ToneSheduler and DAC on the HAL shim and writes what the
+//* i2s PIO would have shifted out into a WAV file. Reports the rendering throughput.
+
+//***************************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <span>
+
+#include "hal_host.h"
+#include "DAC.h"
+#include "ToneSheduler.h"
+#include "SongSequencer.h"
+#include "ui_songs/songs/ui_song_interface.h"
+
+const uint AUDIO_LRCLK = 28;
+const uint AUDIO_BCLK = 27;
+const uint AUDIO_DOUT = 3;
+
+struct WavWriter
+{
+    FILE *file = nullptr;
+    std::vector<int32_t> samples;
+};
+
+static void writeWav(FILE *file, const std::vector<int32_t> &samples, uint32_t sampleRate)
+{
+    const uint16_t channels = 2;
+    const uint16_t bitsPerSample = 32;
+    const uint32_t dataSize = samples.size() * sizeof(int32_t);
+    const uint32_t byteRate = sampleRate * channels * bitsPerSample / 8;
+    const uint16_t blockAlign = channels * bitsPerSample / 8;
+    const uint16_t format = 1; // PCM
+    const uint32_t fmtSize = 16;
+    const uint32_t riffSize = 36 + dataSize;
+
+    fwrite("RIFF", 1, 4, file);
+    fwrite(&riffSize, 4, 1, file);
+    fwrite("WAVEfmt ", 1, 8, file);
+    fwrite(&fmtSize, 4, 1, file);
+    fwrite(&format, 2, 1, file);
+    fwrite(&channels, 2, 1, file);
+    fwrite(&sampleRate, 4, 1, file);
+    fwrite(&byteRate, 4, 1, file);
+    fwrite(&blockAlign, 2, 1, file);
+    fwrite(&bitsPerSample, 2, 1, file);
+    fwrite("data", 1, 4, file);
+    fwrite(&dataSize, 4, 1, file);
+    fwrite(samples.data(), sizeof(int32_t), samples.size(), file);
+}
+
+static void collectSample(void *context, PIO /*pio*/, uint32_t /*sm*/, uint32_t word)
+{
+    WavWriter *writer = (WavWriter *)context;
+    if (DAC::getInstance().getFormat() == DAC_FORMAT_PACKED16)
+    {
+        // the i2s16 program sends both halves as 32 bit slots with the low bits zero
+        writer->samples.push_back((int32_t)(word & 0xFFFF0000));
+        writer->samples.push_back((int32_t)(word << 16));
+    }
+    else
+    {
+        writer->samples.push_back((int32_t)word);
+    }
+}
+
+static const char *const POLICY_NAMES[] = {"none", "oldest", "quietest", "same-pitch", "released-first"};
+
+static const char *const UNDERRUN_NAMES[] = {"none", "zero", "hold"};
+
+static void printUsage(const char *name)
+{
+    printf("Usage: %s [-o output.wav] [-t seconds] [-p policy] [-m blocks] [-u policy] [-v volume] [-s seconds]\n", name);
+    printf("  -o  WAV file to write (default: song.wav)\n");
+    printf("  -t  stop after the given number of seconds (default: whole song)\n");
+    printf("  -p  voice stealing policy: none, oldest, quietest, same-pitch, released-first\n");
+    printf("  -m  miss the refill deadline every given number of blocks (default: never)\n");
+    printf("  -u  underrun policy: none, zero, hold (default: zero)\n");
+    printf("  -s  start the song at the given position in seconds (default: 0)\n");
+    printf("  -v  master volume in percent, like the slider of the UI (default: 100)\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *outputPath = "song.wav";
+    float maxSeconds = 0;
+    float startSeconds = 0;
+    int policy = -1;
+    uint32_t missEvery = 0;
+    int underrunPolicy = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc)
+        {
+            outputPath = argv[++i];
+        }
+        else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+        {
+            maxSeconds = atof(argv[++i]);
+        }
+        else if (!strcmp(argv[i], "-p") && i + 1 < argc)
+        {
+            i++;
+            for (int p = 0; p < (int)(sizeof(POLICY_NAMES) / sizeof(POLICY_NAMES[0])); p++)
+            {
+                if (!strcmp(argv[i], POLICY_NAMES[p]))
+                {
+                    policy = p;
+                }
+            }
+            if (policy < 0)
+            {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[i], "-m") && i + 1 < argc)
+        {
+            missEvery = atoi(argv[++i]);
+        }
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+        {
+            startSeconds = atof(argv[++i]);
+        }
+        else if (!strcmp(argv[i], "-v") && i + 1 < argc)
+        {
+            MasterVolume::getInstance().setVolume(atoi(argv[++i]));
+        }
+        else if (!strcmp(argv[i], "-u") && i + 1 < argc)
+        {
+            i++;
+            underrunPolicy = -1;
+            for (int p = 0; p < (int)(sizeof(UNDERRUN_NAMES) / sizeof(UNDERRUN_NAMES[0])); p++)
+            {
+                if (!strcmp(argv[i], UNDERRUN_NAMES[p]))
+                {
+                    underrunPolicy = p;
+                }
+            }
+            if (underrunPolicy < 0)
+            {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    WavWriter writer;
+    writer.file = fopen(outputPath, "wb");
+    if (!writer.file)
+    {
+        printf("Could not open %s\n", outputPath);
+        return 1;
+    }
+
+    hal_pio_set_tx_sink(collectSample, &writer);
+    DAC::getInstance().setup(AUDIO_LRCLK, AUDIO_BCLK, AUDIO_DOUT, SYNTH_SAMPLE_RATE, SYNTH_OUTPUT_FORMAT);
+
+    DAC::getInstance().setUnderrunPolicy((DACUnderrunPolicy)underrunPolicy);
+
+    static ToneSheduler<> toneSheduler;
+    if (policy >= 0)
+    {
+        toneSheduler.setVoiceStealPolicy((VoiceStealPolicy)policy);
+    }
+
+    // the sequencer streams the song into the scheduler, only a short window ahead
+    static SongSequencer sequencer(toneSheduler);
+    std::span<ui_tone> tones = CSongGetTones();
+    if (sequencer.load(tones, *CSongGetEnvelopes(), *CSongGetChannelPans()) < 0)
+    {
+        printf("Could not load \"%s\", a tone refers to a missing envelope or pan\n", CSongGetName()->c_str());
+        return 1;
+    }
+    sequencer.seek(startSeconds * 1'000'000);
+    sequencer.play();
+
+    const uint32_t songDuration = *CSongGetDuration();
+    const uint64_t maxFrames = maxSeconds > 0 ? (uint64_t)(maxSeconds * SYNTH_SAMPLE_RATE) : UINT64_MAX;
+    uint64_t frames = 0;
+    uint64_t blocks = 0;
+
+    printf("Rendering \"%s\" (%zu tones, %u s) to %s\n", CSongGetName()->c_str(), tones.size(), songDuration / 1'000'000, outputPath);
+
+    auto start = std::chrono::steady_clock::now();
+    while (frames < maxFrames)
+    {
+        sequencer.update();
+
+        if (sequencer.isFinished() && !toneSheduler.busy())
+        {
+            break;
+        }
+
+        // one DMA block is played, then the freed buffer is refilled
+        frames += hal_dma_step() / ToneSheduler<>::WORDS_PER_FRAME;
+        blocks++;
+        if (missEvery != 0 && blocks % missEvery == 0)
+        {
+            // the next block starts before the refill, like a main loop that is busy for too long
+            frames += hal_dma_step() / ToneSheduler<>::WORDS_PER_FRAME;
+        }
+        toneSheduler.cyclicHandler();
+    }
+    // play out the last filled block
+    frames += hal_dma_step() / ToneSheduler<>::WORDS_PER_FRAME;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    writeWav(writer.file, writer.samples, SYNTH_SAMPLE_RATE);
+    fclose(writer.file);
+
+    const double audioSeconds = (double)frames / SYNTH_SAMPLE_RATE;
+    printf("Rendered %llu frames (%.1f s audio) in %.3f s\n", (unsigned long long)frames, audioSeconds, seconds);
+    printf("Throughput: %.0f samples/s, real-time factor %.1fx\n", frames / seconds, audioSeconds / seconds);
+
+    VoiceStats stats = toneSheduler.getVoiceStats();
+    printf("Voices (%s): peak %u of %u, %u steals, %u stalls, %u drops, max start delay %.2f ms\n",
+           POLICY_NAMES[toneSheduler.getVoiceStealPolicy()], stats.peakVoices, SYNTH_VOICES, stats.steals, stats.stalls, stats.drops,
+           stats.maxStartDelay * 1000.0f / SYNTH_SAMPLE_RATE);
+
+    SequencerStats sequencerStats = sequencer.getStats();
+    printf("Sequencer: %u rejected notes", sequencerStats.rejectedNotes);
+    if (sequencerStats.rejectedNotes != 0)
+    {
+        printf(", last error %d", sequencerStats.lastError);
+    }
+    printf("\n");
+
+    DACStats dacStats = DAC::getInstance().getStats();
+    printf("DAC (%s): %u underruns, max fill time %u us, worst slack %d us\n", UNDERRUN_NAMES[underrunPolicy],
+           dacStats.underruns, dacStats.maxFillTimeUs, dacStats.worstSlackUs);
+    return 0;
+}
@@ -0,0 +1,108 @@
+//***************************************************************************************
+//* Checks of the audio engine on the HAL shim
+
+//* Every check prints what went wrong, the exit code is the number of failed checks so
+//* ctest reports them
+
+//***************************************************************************************
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "hal_host.h"
+#include "DAC.h"
+#include "TimingWheel.h"
+#include "ToneSheduler.h"
+
+static uint32_t failures = 0;
+
+#define CHECK(condition)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if (!(condition))                                                       \
+        {                                                                       \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+//***************************************************************************************
+//* More due events than fit into one pop are returned with the next block, earliest
+//* first
+//***************************************************************************************
+static void testWheelOverflow()
+{
+    const uint32_t BLOCK = 512;
+    const uint32_t EVENTS = MAX_STARTS_PER_BLOCK + 8;
+    static TimingWheel<BLOCK> wheel;
+    static NoteEvent events[MAX_STARTS_PER_BLOCK];
+
+    // reverse order, so the latest events come out of the bucket first
+    for (uint32_t i = 0; i < EVENTS; i++)
+    {
+        NoteEvent event = {};
+        event.startTime = 3 * BLOCK + EVENTS - 1 - i;
+        CHECK(wheel.insert(event, 3));
+    }
+
+    CHECK(wheel.popDue(2 * BLOCK, 3 * BLOCK, events, MAX_STARTS_PER_BLOCK) == 0);
+
+    uint32_t count = wheel.popDue(3 * BLOCK, 4 * BLOCK, events, MAX_STARTS_PER_BLOCK);
+    CHECK(count == MAX_STARTS_PER_BLOCK);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        CHECK(events[i].startTime == 3 * BLOCK + i);
+    }
+
+    count = wheel.popDue(4 * BLOCK, 5 * BLOCK, events, MAX_STARTS_PER_BLOCK);
+    CHECK(count == EVENTS - MAX_STARTS_PER_BLOCK);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        CHECK(events[i].startTime == 3 * BLOCK + MAX_STARTS_PER_BLOCK + i);
+    }
+    CHECK(wheel.empty());
+}
+
+//***************************************************************************************
+//* Notes beyond MAX_STARTS_PER_BLOCK in one block start with the next block
+//***************************************************************************************
+static void testSchedulerOverflow()
+{
+    typedef ToneSheduler<32> Sheduler;
+    static Sheduler toneSheduler;
+    typename Sheduler::Profile profile = typename Sheduler::Profile(0.01, 0.1, 0.5, 0.3);
+    const uint32_t NOTES = MAX_STARTS_PER_BLOCK + 8;
+
+    for (uint32_t i = 0; i < NOTES; i++)
+    {
+        CHECK(toneSheduler.addToneAbs(110.0f + 10.0f * i, 0, 1, profile) == 0);
+    }
+
+    for (uint32_t block = 0; block < 4; block++)
+    {
+        hal_dma_step();
+        toneSheduler.cyclicHandler();
+    }
+
+    // the extra notes take over the oldest voices one block late
+    VoiceStats stats = toneSheduler.getVoiceStats();
+    CHECK(stats.peakVoices == 32);
+    CHECK(stats.steals == NOTES - 32);
+    CHECK(stats.maxStartDelay >= Sheduler::BLOCK_FRAMES);
+    CHECK(stats.maxStartDelay < 2 * Sheduler::BLOCK_FRAMES);
+    toneSheduler.stopAll();
+}
+
+int main()
+{
+    DAC::getInstance().setup(28, 27, 3, SYNTH_SAMPLE_RATE, SYNTH_OUTPUT_FORMAT);
+
+    testWheelOverflow();
+    testSchedulerOverflow();
+
+    if (failures == 0)
+    {
+        printf("All checks passed\n");
+    }
+    return failures;
+}
@@ -537,15 +537,11 @@ static ili9488_status_t ili9488_fill_round_rectangle(const uint16_t page, const
 	// Check if init
 	if ( gb_is_init )
 	{
-		// Combinations with rectanangles and cicles to produce rounded rectangle
-		status |= ili9488_fill_rectangle( page ,	 		col + radius, p_size + 1, 	c_size - 2 * radius, 				color );
-		status |= ili9488_fill_rectangle( page + radius, 	col, p_size - 2 * radius, 	radius, 							color );
-		status |= ili9488_fill_rectangle( page + radius, 	col + c_size - radius, 		p_size - 2 * radius, radius + 1,	color );
-
-		status |= ili9488_fill_circle( page + radius, 			col + radius, 			radius, color );
-		status |= ili9488_fill_circle( page + radius, 			col + c_size - radius, 	radius, color );
-		status |= ili9488_fill_circle( page + p_size - radius, 	col + radius,			radius, color );
-		status |= ili9488_fill_circle( page + p_size  - radius,	col + c_size - radius, 	radius, color );
+		// Spans of the corner circles and one rectangle in between
+		if ( eILI9488_OK != ili9488_driver_fill_round_rectangle( page, col, p_size, c_size, radius, color ))
+		{
+			status = eILI9488_ERROR;
+		}
 	}
 	else
 	{
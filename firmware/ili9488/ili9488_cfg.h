@@ -69,6 +69,46 @@
 #define ILI9488_FONT_24_USE_EN			( 1 )
 
 
+// **********************************************************
+// 	TEXT
+// **********************************************************
+//
+//	Rasterised glyphs are cached in SRAM and sent straight from
+//	there by DMA. The cache is keyed by char, font and colours,
+//	the least recently used glyph is replaced.
+
+// Enable glyph cache (0/1)
+#define ILI9488_GLYPH_CACHE_EN			( 1 )
+
+// Size of glyph cache, one glyph takes 816 B
+#define ILI9488_GLYPH_CACHE_SIZE		( 16U * 1024U )
+
+//	Without the cache strings are rasterised into strips of this
+//	many chars in the queue arena, while earlier strips are sent
+
+// Number of chars per string strip, one char takes 816 B of arena
+#define ILI9488_STRING_STRIP_CHARS		( 4U )
+
+
+// **********************************************************
+// 	QUEUE
+// **********************************************************
+//
+//	Drawing calls append their transfers to a queue that is sent
+//	by the DMA interrupt, the caller only waits when it is full.
+
+// Number of queued operations, power of two
+// Size: 32 B per operation
+#define ILI9488_QUEUE_LENGTH			( 64U )
+
+// Size of arena for pixels built on the fly
+#define ILI9488_QUEUE_ARENA_SIZE		( 8U * 1024U )
+
+// Longest wait for room in the queue or the arena in us,
+// the push or allocation fails after it
+#define ILI9488_QUEUE_TIMEOUT_US		( 100U * 1000U )
+
+
 // **********************************************************
 // 	BACKLIGHT
 // **********************************************************
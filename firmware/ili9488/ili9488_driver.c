@@ -23,8 +23,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include "ili9488_driver.h"
 #include "ili9488_font.h"
+#include "ili9488_glyph_cache.h"
 #include "ili9488_cfg.h"
 #include "ili9488_if.h"
+#include "ili9488_queue.h"
 #include "pico/stdlib.h"
 #include "pico/mem_ops.h"
 
@@ -43,12 +45,16 @@ extern const uint DEBUG2_PIN;
 extern const uint DEBUG3_PIN;
 extern const uint DEBUG4_PIN;
 
+#if (( 0 == ILI9488_GLYPH_CACHE_EN ) && ( ILI9488_QUEUE_ARENA_SIZE < ( ILI9488_STRING_STRIP_CHARS * ILI9488_MAX_FONT_HEIGHT * ILI9488_MAX_FONT_WIDTH * 2U )))
+	#error "ILI9488_QUEUE_ARENA_SIZE must hold a string strip"
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
-uint16_t g_charBuffer[2][ILI9488_MAX_FONT_HEIGHT * ILI9488_MAX_FONT_WIDTH];	
-uint8_t g_charBufferIdx = 0;
+// Boundaries of the address window, ones that did not change are not sent again
+static uint16_t g_cursorCol[2] = { UINT16_MAX, UINT16_MAX };
+static uint16_t g_cursorPage[2] = { UINT16_MAX, UINT16_MAX };
 
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
@@ -64,6 +70,13 @@ static ili9488_status_t ili9488_driver_set_image_function		(void);
 
 static uint16_t 		ili9488_driver_convert_to_rgb565		(const ili9488_rgb_t color);
 static ili9488_status_t ili9488_driver_draw_hline				(const uint16_t page, const uint16_t col, const uint16_t length, const ili9488_rgb_t color);
+static ili9488_status_t ili9488_driver_draw_vline				(const uint16_t page, const uint16_t col, const uint16_t length, const ili9488_rgb_t color);
+static void				ili9488_driver_get_circle_extent		(const uint16_t radius, uint16_t * const p_extent);
+static ili9488_status_t ili9488_driver_fill_round_shape			(const uint16_t page_l, const uint16_t page_r, const uint16_t col_t, const uint16_t col_b, const uint16_t radius, const ili9488_rgb_t color);
+static void				ili9488_driver_rasterise_char			(const uint8_t ch, const ili9488_font_t * const p_font, uint16_t * const p_buf, const uint16_t fg_rgb, const uint16_t bg_rgb);
+#if ( ILI9488_GLYPH_CACHE_EN )
+static uint16_t * 		ili9488_driver_get_glyph				(const uint8_t ch, const ili9488_font_t * const p_font, const ili9488_font_opt_t font_opt, const uint16_t fg_rgb, const uint16_t bg_rgb);
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -95,6 +108,7 @@ ili9488_status_t ili9488_driver_init(void)
 
 		// Soft Reset
 		status |= ili9488_driver_soft_reset();
+		status |= ili9488_queue_flush();
 		sleep_ms( 100 );
 
 
@@ -157,6 +171,10 @@ ili9488_status_t ili9488_driver_soft_reset(void)
 
 	status = ili9488_low_if_write_register( eILI9488_SOFTRST_CMD, NULL, 0U );
 
+	// Reset also resets the address window
+	g_cursorCol[0] = UINT16_MAX;
+	g_cursorPage[0] = UINT16_MAX;
+
 	return status;
 }
 
@@ -638,6 +656,9 @@ ili9488_status_t ili9488_driver_read_pixel_format(ili9488_pixel_format_t * const
 /**
 *		Set cursor
 *
+*	Boundaries that equal the ones of the previous window are not
+*	sent again.
+*
 * @param[in]	col_s - Start column
 * @param[in]	col_e - End column
 * @param[in]	page_s - Start page
@@ -663,20 +684,32 @@ ili9488_status_t ili9488_driver_set_cursor(const uint16_t col_s, const uint16_t
 	else
 	{
 		// Column boundary
-		baundary[0] = (( col_s >> 8U ) & 0xFFU );
-		baundary[1] = (( col_s >> 0U ) & 0xFFU );
-		baundary[2] = (( col_e >> 8U ) & 0xFFU );
-		baundary[3] = (( col_e >> 0U ) & 0xFFU );
+		if (( col_s != g_cursorCol[0] ) || ( col_e != g_cursorCol[1] ))
+		{
+			baundary[0] = (( col_s >> 8U ) & 0xFFU );
+			baundary[1] = (( col_s >> 0U ) & 0xFFU );
+			baundary[2] = (( col_e >> 8U ) & 0xFFU );
+			baundary[3] = (( col_e >> 0U ) & 0xFFU );
+
+			status |= ili9488_low_if_write_register( eILI9488_SET_COL_ADDR_CMD, (uint8_t*) &baundary, 4U );
 
-		status |= ili9488_low_if_write_register( eILI9488_SET_COL_ADDR_CMD, (uint8_t*) &baundary, 4U );
+			g_cursorCol[0] = col_s;
+			g_cursorCol[1] = col_e;
+		}
 
 		// Page boundary
-		baundary[0] = (( page_s >> 8U ) & 0xFFU );
-		baundary[1] = (( page_s >> 0U ) & 0xFFU );
-		baundary[2] = (( page_e >> 8U ) & 0xFFU );
-		baundary[3] = (( page_e >> 0U ) & 0xFFU );
+		if (( page_s != g_cursorPage[0] ) || ( page_e != g_cursorPage[1] ))
+		{
+			baundary[0] = (( page_s >> 8U ) & 0xFFU );
+			baundary[1] = (( page_s >> 0U ) & 0xFFU );
+			baundary[2] = (( page_e >> 8U ) & 0xFFU );
+			baundary[3] = (( page_e >> 0U ) & 0xFFU );
 
-		status |= ili9488_low_if_write_register( eILI9488_SET_PAGE_ADDR_CMD, (uint8_t*) &baundary, 4U );
+			status |= ili9488_low_if_write_register( eILI9488_SET_PAGE_ADDR_CMD, (uint8_t*) &baundary, 4U );
+
+			g_cursorPage[0] = page_s;
+			g_cursorPage[1] = page_e;
+		}
 	}
 
 	return status;
@@ -729,13 +762,16 @@ ili9488_status_t ili9488_driver_read_memory(uint8_t * const p_mem, const uint32_
 static uint16_t ili9488_driver_convert_to_rgb565(const ili9488_rgb_t color)
 {
 	ili9488_rgb565_t rgb565;
+	uint16_t rgb;
 
 	// Convert color
 	rgb565.R = (uint8_t) ( color.r >> 3U );
 	rgb565.G = (uint8_t) ( color.g >> 2U );
 	rgb565.B = (uint8_t) ( color.b >> 3U );
 
-	return *((uint16_t*)(&rgb565));
+	memcpy( &rgb, &rgb565, sizeof( rgb ));
+
+	return rgb;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -756,12 +792,17 @@ ili9488_status_t ili9488_driver_set_pixel(const uint16_t page, const uint16_t co
 	// Convert color
 	rgb = ili9488_driver_convert_to_rgb565( color );
 
+	// Window and pixel are sent as one transaction
+	ili9488_queue_begin();
+
 	// Set cursor
 	status |= ili9488_driver_set_cursor( col, col, page, page );
 
 	// Write memory
 	ili9488_low_if_write_rgb_to_gram( &rgb, 1U, false);
 
+	ili9488_queue_end();
+
 	return status;
 }
 
@@ -799,14 +840,16 @@ ili9488_status_t ili9488_driver_fill_rectangle(const uint16_t page, const uint16
 		// Calculate size of pixels
 		pixel_size = (uint32_t) ( col_size * page_size );
 
-		// Wait until previous operation is finished
-		ili9488_if_wait_for_ready();
+		// Window and fill are sent as one transaction
+		ili9488_queue_begin();
 
 		// Set cursor
 		status |= ili9488_driver_set_cursor( col, col + col_size - 1, page, page + page_size - 1);
 
 		// Write to memory
 		status |= ili9488_low_if_write_rgb_to_gram( &rgb, pixel_size, false);
+
+		ili9488_queue_end();
 	}
 
 	return status;
@@ -824,13 +867,111 @@ ili9488_status_t ili9488_driver_fill_rectangle(const uint16_t page, const uint16
 */
 ////////////////////////////////////////////////////////////////////////////////
 static ili9488_status_t ili9488_driver_draw_hline(const uint16_t page, const uint16_t col, const uint16_t length, const ili9488_rgb_t color)
+{
+	// One window, one constant color transfer
+	return ili9488_driver_fill_rectangle( page, col, length, 1U, color );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Draw vertical line
+*
+* @param[in]	page 	- Start page
+* @param[in]	col 	- Start column
+* @param[in]	length 	- Length of line
+* @param[in]	color 	- Color of line
+* @return		status - Either Ok or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_draw_vline(const uint16_t page, const uint16_t col, const uint16_t length, const ili9488_rgb_t color)
+{
+	// One window, one constant color transfer
+	return ili9488_driver_fill_rectangle( page, col, 1U, length, color );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get half widths of a filled circle
+*
+*	Runs the midpoint circle algorithm and stores for every column
+*	offset from the center the page offset of the outermost pixel.
+*
+* @note	The algorithm is copied from github: https://github.com/RobertoBenjami/stm32_graphics_display_drivers/blob/master/Drivers/stm32_adafruit_lcd.c
+*
+* @param[in]	radius 		- Radius of circle
+* @param[out]	p_extent 	- Half widths, radius + 1 entries
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void ili9488_driver_get_circle_extent(const uint16_t radius, uint16_t * const p_extent)
+{
+	int32_t  D;
+	int32_t  CurX;
+	int32_t  CurY;
+
+	memset( p_extent, 0, ( radius + 1U ) * sizeof( uint16_t ));
+
+	D = 3 - (radius << 1);
+	CurX = 0;
+	CurY = radius;
+
+	while (CurX <= CurY)
+	{
+		p_extent[CurX] = MAX( p_extent[CurX], CurY );
+		p_extent[CurY] = MAX( p_extent[CurY], CurX );
+
+		if (D < 0)
+		{
+			D += (CurX << 2) + 6;
+		}
+		else
+		{
+			D += ((CurX - CurY) << 2) + 10;
+			CurY--;
+		}
+
+		CurX++;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Fill shape with round corners
+*
+*	Fills the shape that four circles of same radius span, centered
+*	at page_l/page_r and col_t/col_b. Columns whose half width does
+*	not change are merged into one rectangle, the upper and lower
+*	rectangle of a pair share their pages and are sent back to back.
+*
+* @param[in]	page_l 	- Page of left centers
+* @param[in]	page_r 	- Page of right centers
+* @param[in]	col_t 	- Column of top centers
+* @param[in]	col_b 	- Column of bottom centers
+* @param[in]	radius 	- Radius of corners
+* @param[in]	color 	- Color of shape
+* @return		status - Either Ok or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_fill_round_shape(const uint16_t page_l, const uint16_t page_r, const uint16_t col_t, const uint16_t col_b, const uint16_t radius, const ili9488_rgb_t color)
 {
 	ili9488_status_t status = eILI9488_OK;
-	uint16_t i;
+	uint16_t extent[ ILI9488_DISPLAY_SIZE_COLUMN / 2 + 1 ];
+	uint16_t d;
+	uint16_t d_end;
+
+	ili9488_driver_get_circle_extent( radius, extent );
 
-	for ( i = 0; i < length; i++ )
+	// Middle band with full width
+	for ( d_end = 1; ( d_end <= radius ) && ( extent[d_end] == extent[0] ); d_end++ ) {}
+	status |= ili9488_driver_fill_rectangle( page_l - extent[0], col_t - ( d_end - 1U ), page_r - page_l + 2U * extent[0] + 1U, col_b - col_t + 2U * ( d_end - 1U ) + 1U, color );
+
+	// Upper and lower bands of equal width
+	for ( d = d_end; d <= radius; d = d_end )
 	{
-		status |= ili9488_driver_set_pixel( page + i, col, color );
+		for ( d_end = d + 1U; ( d_end <= radius ) && ( extent[d_end] == extent[d] ); d_end++ ) {}
+
+		status |= ili9488_driver_fill_rectangle( page_l - extent[d], col_t - ( d_end - 1U ), page_r - page_l + 2U * extent[d] + 1U, d_end - d, color );
+		status |= ili9488_driver_fill_rectangle( page_l - extent[d], col_b + d, page_r - page_l + 2U * extent[d] + 1U, d_end - d, color );
 	}
 
 	return status;
@@ -840,8 +981,6 @@ static ili9488_status_t ili9488_driver_draw_hline(const uint16_t page, const uin
 /**
 *		Fill (draw) circle
 *
-* @note	This function is copied from github: https://github.com/RobertoBenjami/stm32_graphics_display_drivers/blob/master/Drivers/stm32_adafruit_lcd.c
-*
 * @param[in]	page 	- Start page
 * @param[in]	col 	- Start column
 * @param[in]	radius 	- Radius of circle
@@ -852,9 +991,6 @@ static ili9488_status_t ili9488_driver_draw_hline(const uint16_t page, const uin
 ili9488_status_t ili9488_driver_fill_circle(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_rgb_t color)
 {
 	ili9488_status_t status = eILI9488_OK;
-	int32_t  D;
-	uint32_t  CurX;
-	uint32_t  CurY;
 
 	// Check limits
 	if 	(	(( col + radius ) > ILI9488_DISPLAY_SIZE_COLUMN )
@@ -868,64 +1004,47 @@ ili9488_status_t ili9488_driver_fill_circle(const uint16_t page, const uint16_t
 	}
 	else
 	{
-		D = ( 3U - ( radius << 1U ));
-		CurX = 0U;
-		CurY = radius;
-
-		while ( CurX <= CurY )
-		{
-			if(CurY > 0)
-			{
-				status |= ili9488_driver_draw_hline( page - CurY, col + CurX, 2*CurY, color );
-				status |= ili9488_driver_draw_hline( page - CurY, col - CurX, 2*CurY, color );
-			}
-
-			if(CurX > 0)
-			{
-				status |= ili9488_driver_draw_hline( page - CurX, col - CurY, 2*CurX, color );
-				status |= ili9488_driver_draw_hline( page - CurX, col + CurY, 2*CurX, color );
-			}
-
-			if (D < 0)
-			{
-				D += (CurX << 2) + 6;
-			}
-			else
-			{
-				D += ((CurX - CurY) << 2) + 10;
-				CurY--;
-			}
-
-			CurX++;
-		}
+		status = ili9488_driver_fill_round_shape( page, page, col, col, radius, color );
+	}
 
-		D = 3 - (radius << 1);
-		CurX = 0;
-		CurY = radius;
+	return status;
+}
 
-		while (CurX <= CurY)
-		{
-			status |= ili9488_driver_set_pixel(( page + CurX ), ( col - CurY ), color );
-			status |= ili9488_driver_set_pixel(( page - CurX ), ( col - CurY ), color );
-			status |= ili9488_driver_set_pixel(( page + CurY ), ( col - CurX ), color );
-			status |= ili9488_driver_set_pixel(( page - CurY ), ( col - CurX ), color );
-			status |= ili9488_driver_set_pixel(( page + CurX ), ( col + CurY ), color );
-			status |= ili9488_driver_set_pixel(( page - CurX ), ( col + CurY ), color );
-			status |= ili9488_driver_set_pixel(( page + CurY ), ( col + CurX ), color );
-			status |= ili9488_driver_set_pixel(( page - CurY ), ( col + CurX ), color );
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Fill rectangle with round corners
+*
+*	The corners are quarters of circles centered radius pixels inside
+*	the rectangle, the radius is limited to half the smaller side.
+*	The rectangle spans page_size + 1 pages and col_size + 1 columns.
+*
+* @param[in]	page 		- Start page
+* @param[in]	col 		- Start column
+* @param[in]	page_size 	- Size of page
+* @param[in]	col_size 	- Size of column
+* @param[in]	radius 		- Radius of corners
+* @param[in]	color 		- Color of rectangle
+* @return		status - Either Ok or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_fill_round_rectangle(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const uint16_t radius, const ili9488_rgb_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint16_t corner;
 
-			if (D < 0)
-			{
-				D += (CurX << 2) + 6;
-			}
-			else
-			{
-				D += ((CurX - CurY) << 2) + 10;
-				CurY--;
-			}
+	// Check limits
+	if 	(	(( col + col_size ) >= ILI9488_DISPLAY_SIZE_COLUMN )
+		||	(( page + page_size ) >= ILI9488_DISPLAY_SIZE_PAGE ))
+	{
+		status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Filling round rectangle invalid spacing..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		corner = MIN( radius, MIN( page_size, col_size ) / 2U );
 
-			CurX++;
-		}
+		status = ili9488_driver_fill_round_shape( page + corner, page + page_size - corner, col + corner, col + col_size - corner, corner, color );
 	}
 
 	return status;
@@ -935,6 +1054,8 @@ ili9488_status_t ili9488_driver_fill_circle(const uint16_t page, const uint16_t
 /**
 *		Set (draw) circle
 *
+*	The pixels of an octant that share a column form a run, every run
+*	and its mirror images are drawn as horizontal and vertical lines.
 *
 * @note	This function is copied from github: https://github.com/RobertoBenjami/stm32_graphics_display_drivers/blob/master/Drivers/stm32_adafruit_lcd.c
 *
@@ -949,8 +1070,10 @@ ili9488_status_t ili9488_driver_set_circle(const uint16_t page, const uint16_t c
 {
 	ili9488_status_t status = eILI9488_OK;
 	int32_t  D;
-	uint32_t  CurX;
-	uint32_t  CurY;
+	int32_t  CurX;
+	int32_t  CurY;
+	int32_t  NextY;
+	int32_t  RunX = 0;
 
 	// Check limits
 	if 	(	(( col + radius ) > ILI9488_DISPLAY_SIZE_COLUMN )
@@ -970,14 +1093,33 @@ ili9488_status_t ili9488_driver_set_circle(const uint16_t page, const uint16_t c
 
 		while (CurX <= CurY)
 		{
-			status |= ili9488_driver_set_pixel(( page + CurX ), ( col - CurY ), color );
-			status |= ili9488_driver_set_pixel(( page - CurX ), ( col - CurY ), color );
-			status |= ili9488_driver_set_pixel(( page + CurY ), ( col - CurX ), color );
-			status |= ili9488_driver_set_pixel(( page - CurY ), ( col - CurX ), color );
-			status |= ili9488_driver_set_pixel(( page + CurX ), ( col + CurY ), color );
-			status |= ili9488_driver_set_pixel(( page - CurX ), ( col + CurY ), color );
-			status |= ili9488_driver_set_pixel(( page + CurY ), ( col + CurX ), color );
-			status |= ili9488_driver_set_pixel(( page - CurY ), ( col + CurX ), color );
+			NextY = ( D < 0 ) ? CurY : CurY - 1;
+
+			// Run from RunX to CurX ends
+			if (( NextY != CurY ) || (( CurX + 1 ) > NextY ))
+			{
+				if ( 0 == RunX )
+				{
+					// Run crosses the axis
+					status |= ili9488_driver_draw_hline( page - CurX, col - CurY, 2U * CurX + 1U, color );
+					status |= ili9488_driver_draw_hline( page - CurX, col + CurY, 2U * CurX + 1U, color );
+					status |= ili9488_driver_draw_vline( page - CurY, col - CurX, 2U * CurX + 1U, color );
+					status |= ili9488_driver_draw_vline( page + CurY, col - CurX, 2U * CurX + 1U, color );
+				}
+				else
+				{
+					status |= ili9488_driver_draw_hline( page - CurX, col - CurY, CurX - RunX + 1U, color );
+					status |= ili9488_driver_draw_hline( page + RunX, col - CurY, CurX - RunX + 1U, color );
+					status |= ili9488_driver_draw_hline( page - CurX, col + CurY, CurX - RunX + 1U, color );
+					status |= ili9488_driver_draw_hline( page + RunX, col + CurY, CurX - RunX + 1U, color );
+					status |= ili9488_driver_draw_vline( page - CurY, col - CurX, CurX - RunX + 1U, color );
+					status |= ili9488_driver_draw_vline( page - CurY, col + RunX, CurX - RunX + 1U, color );
+					status |= ili9488_driver_draw_vline( page + CurY, col - CurX, CurX - RunX + 1U, color );
+					status |= ili9488_driver_draw_vline( page + CurY, col + RunX, CurX - RunX + 1U, color );
+				}
+
+				RunX = CurX + 1;
+			}
 
 			if (D < 0)
 			{
@@ -996,6 +1138,105 @@ ili9488_status_t ili9488_driver_set_circle(const uint16_t page, const uint16_t c
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Rasterise character into pixel buffer
+*
+*	The pixels are stored in GRAM order of a char window, page by
+*	page with height pixels each. A string of chars is therefore the
+*	plain concatenation of its char buffers.
+*
+* @param[in] 	ch - Character to rasterise
+* @param[in] 	p_font - Font to use
+* @param[out] 	p_buf - Buffer of font width x height pixels
+* @param[in] 	fg_rgb - Foreground color in RGB565
+* @param[in] 	bg_rgb - Background color in RGB565
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void ili9488_driver_rasterise_char(const uint8_t ch, const ili9488_font_t * const p_font, uint16_t * const p_buf, const uint16_t fg_rgb, const uint16_t bg_rgb)
+{
+	uint32_t lut_offset;
+	uint8_t i;
+	uint8_t j;
+	uint32_t line;
+	uint8_t line_size_bit;
+	uint8_t line_size_byte;
+	uint8_t line_bit_offset;
+	uint8_t char_lut_size;
+	uint8_t pixel_page;
+
+	// Clear buffer (memset for 16bit seems not to work)
+	uint16_t *buf = p_buf;
+	int16_t count = (p_font->width) * p_font->height;
+	while(count--) *buf++ = bg_rgb;
+
+	// Calculate various font table info
+	line_size_bit = ((( p_font -> width / 8U ) * 8U ) + 8U );
+	line_size_byte = ( line_size_bit / 8U );
+	line_bit_offset = ( line_size_bit - ( p_font -> width ));
+	char_lut_size = ( p_font -> height * line_size_byte );
+
+	// Calculate table offset
+	lut_offset = char_lut_size * ( ch - 32U );
+
+	// Every line
+	for ( i = 0; i < p_font -> height; i ++ )
+	{
+		// Assemble line
+		line = 0;
+		for ( j = 0; j < line_size_byte; j++ )
+		{
+			line |= ( p_font -> p_font[ lut_offset + ( i * line_size_byte ) + j ] << ( line_size_bit - ( 8U * ( j + 1U ))));
+		}
+
+		// Every pixel
+		for( j = line_bit_offset; j < line_size_bit; j++ )
+		{
+			// The glyph starts one page into the window, its last page is cut off
+			pixel_page = line_size_bit - j;
+
+			if (( line & ( 1 << j )) && ( pixel_page < p_font -> width ))
+			{
+				p_buf[ i + ( pixel_page * p_font -> height ) ] = fg_rgb;
+			}
+		}
+	}
+}
+
+#if ( ILI9488_GLYPH_CACHE_EN )
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get glyph from cache, rasterise it on a miss
+*
+* @param[in] 	ch - Character
+* @param[in] 	p_font - Font data
+* @param[in] 	font_opt - Font of choise
+* @param[in] 	fg_rgb - Foreground color in RGB565
+* @param[in] 	bg_rgb - Background color in RGB565
+* @return		p_glyph - Pixels of the glyph, ready for DMA, NULL if no slot got free
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t * ili9488_driver_get_glyph(const uint8_t ch, const ili9488_font_t * const p_font, const ili9488_font_opt_t font_opt, const uint16_t fg_rgb, const uint16_t bg_rgb)
+{
+	uint16_t * p_glyph;
+
+	p_glyph = ili9488_glyph_cache_find( ch, font_opt, fg_rgb, bg_rgb );
+
+	if ( NULL == p_glyph )
+	{
+		p_glyph = ili9488_glyph_cache_insert( ch, font_opt, fg_rgb, bg_rgb );
+
+		if ( NULL != p_glyph )
+		{
+			ili9488_driver_rasterise_char( ch, p_font, p_glyph, fg_rgb, bg_rgb );
+		}
+	}
+
+	return p_glyph;
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Set (draw) character
@@ -1011,74 +1252,46 @@ ili9488_status_t ili9488_driver_set_circle(const uint16_t page, const uint16_t c
 ////////////////////////////////////////////////////////////////////////////////
 ili9488_status_t ili9488_driver_set_char(const uint8_t ch, const uint16_t page, const uint16_t col, const ili9488_rgb_t fg_color, const ili9488_rgb_t  bg_color, const ili9488_font_opt_t font_opt)
 {
-	uint16_t bg_color_u16 = ili9488_driver_convert_to_rgb565(bg_color);
-	uint16_t fg_color_u16 = ili9488_driver_convert_to_rgb565(fg_color);
-
 	ili9488_status_t status = eILI9488_OK;
-	uint32_t lut_offset;
-	uint8_t i;
-	uint8_t j;
-	uint32_t line;
 	const ili9488_font_t * p_font;
-	uint8_t line_size_bit;
-	uint8_t line_size_byte;
-	uint8_t line_bit_offset;
-	uint8_t char_lut_size;
+	uint16_t * p_glyph;
 
 	// Get font data
 	p_font = ili9488_font_get( font_opt );
 
-	// Old function takes 9.1ms
-	// New function takes 250us
-
-	// Clear buffer (memset for 16bit seems not to work)
-	uint16_t *buf = g_charBuffer[!g_charBufferIdx];
-	int16_t count = (p_font->width) * p_font->height;
-    while(count--) *buf++ = bg_color_u16;
-	
 	// Check pinter
 	if ( NULL != p_font )
 	{
-		// Calculate various font table info
-		line_size_bit = ((( p_font -> width / 8U ) * 8U ) + 8U );
-		line_size_byte = ( line_size_bit / 8U );
-		line_bit_offset = ( line_size_bit - ( p_font -> width ));
-		char_lut_size = ( p_font -> height * line_size_byte );
-
-		// Calculate table offset
-		lut_offset = char_lut_size * ( ch - 32U );
-
-		// Every line
-		for ( i = 0; i < p_font -> height; i ++ )
-		{
-			// Assemble line
-			line = 0;
-			for ( j = 0; j < line_size_byte; j++ )
+		// Look up or rasterise while previous transfers are still queued
+		#if ( ILI9488_GLYPH_CACHE_EN )
+			p_glyph = ili9488_driver_get_glyph( ch, p_font, font_opt, ili9488_driver_convert_to_rgb565( fg_color ), ili9488_driver_convert_to_rgb565( bg_color ));
+		#else
+			p_glyph = ili9488_queue_alloc((p_font->width) * p_font->height );
+			if ( NULL != p_glyph )
 			{
-				line |= ( p_font -> p_font[ lut_offset + ( i * line_size_byte ) + j ] << ( line_size_bit - ( 8U * ( j + 1U ))));
+				ili9488_driver_rasterise_char( ch, p_font, p_glyph, ili9488_driver_convert_to_rgb565( fg_color ), ili9488_driver_convert_to_rgb565( bg_color ));
 			}
+		#endif
 
-			// Every pixel
-			for( j = line_bit_offset; j < line_size_bit; j++ )
-			{
-				
-				if ( line & ( 1 << j ))
-				{
-					g_charBuffer[!g_charBufferIdx][ ( i ) + ( (line_size_bit - j) * p_font -> height) ] = fg_color_u16;
-				}
-			}
+		// Arena stayed full
+		if ( NULL == p_glyph )
+		{
+			status = eILI9488_ERROR;
 		}
-		// Wait until previous operation is finished
-		ili9488_if_wait_for_ready();
-		// Swap buffer when previous operation is finished
-		g_charBufferIdx = !g_charBufferIdx;
+		else
+		{
+			// Window and glyph are sent as one transaction
+			ili9488_queue_begin();
 
-		// Set cursor
-		status |= ili9488_driver_set_cursor( col, col + p_font->height - 1, page, page + p_font->width - 1);
+			// Set cursor
+			status |= ili9488_driver_set_cursor( col, col + p_font->height - 1, page, page + p_font->width - 1);
 
-		// Write to memory
-		status |= ili9488_low_if_write_rgb_to_gram( (uint16_t * const) &g_charBuffer[g_charBufferIdx], (p_font->width) * p_font->height, true);
+			// Write to memory
+			status |= ili9488_low_if_write_rgb_to_gram( p_glyph, (p_font->width) * p_font->height, true);
 
+			ili9488_queue_end();
+			ili9488_glyph_cache_pin( p_glyph, ili9488_queue_get_ticket());
+		}
 	}
 
 	// No font
@@ -1094,6 +1307,13 @@ ili9488_status_t ili9488_driver_set_char(const uint8_t ch, const uint16_t page,
 /**
 *		Set string
 *
+*	The whole string is written as one address window. With the glyph
+*	cache every char is sent straight from the cache, otherwise the
+*	string is rasterised in strips of ILI9488_STRING_STRIP_CHARS chars
+*	into the queue arena. The next glyph or strip is prepared while the
+*	previous ones are sent. Chars that do not fit onto the display are
+*	cut off.
+*
 * @param[in] 	str - Pointer to string
 * @param[in] 	page - Start page
 * @param[in] 	col - Start column
@@ -1106,18 +1326,75 @@ ili9488_status_t ili9488_driver_set_char(const uint8_t ch, const uint16_t page,
 ili9488_status_t ili9488_driver_set_string(const char *str, const uint16_t page, const uint16_t col, const ili9488_rgb_t fg_color, const ili9488_rgb_t  bg_color, const ili9488_font_opt_t font_opt)
 {
 	ili9488_status_t status = eILI9488_OK;
-	uint16_t page_walker = page;
-	uint8_t font_width;
+	const ili9488_font_t * p_font;
+	uint16_t fg_rgb;
+	uint16_t bg_rgb;
+	uint32_t char_pixels;
+	uint32_t ch_num;
+	uint32_t strip_chars;
+	uint16_t * p_strip;
+	bool first_strip = true;
+#if ( 0 == ILI9488_GLYPH_CACHE_EN )
+	uint32_t i;
+#endif
 
-	// Get font width
-	font_width = ili9488_font_get_width( font_opt );
+	// Get font data
+	p_font = ili9488_font_get( font_opt );
 
-	// Print chars
-	while( *str )
+	if (( NULL == p_font ) || ( page >= ILI9488_DISPLAY_SIZE_PAGE ))
 	{
-		ili9488_driver_set_char( *str, page_walker, col, fg_color, bg_color, font_opt );
-		str++;
-		page_walker += font_width;
+		status = eILI9488_ERROR;
+	}
+	else
+	{
+		// Number of chars that fit onto the display
+		ch_num = strlen( str );
+		if ( ch_num > (uint32_t)(( ILI9488_DISPLAY_SIZE_PAGE - page ) / p_font -> width ))
+		{
+			ch_num = (uint32_t)(( ILI9488_DISPLAY_SIZE_PAGE - page ) / p_font -> width );
+		}
+
+		fg_rgb = ili9488_driver_convert_to_rgb565( fg_color );
+		bg_rgb = ili9488_driver_convert_to_rgb565( bg_color );
+		char_pixels = p_font -> width * p_font -> height;
+
+		while 	(	( ch_num > 0U )
+				&&	( eILI9488_OK == status ))
+		{
+			// Prepare next strip while the previous ones are sent
+			#if ( ILI9488_GLYPH_CACHE_EN )
+				strip_chars = 1U;
+				p_strip = ili9488_driver_get_glyph( *str++, p_font, font_opt, fg_rgb, bg_rgb );
+			#else
+				strip_chars = ( ch_num < ILI9488_STRING_STRIP_CHARS ) ? ch_num : ILI9488_STRING_STRIP_CHARS;
+				p_strip = ili9488_queue_alloc( strip_chars * char_pixels );
+				for ( i = 0; ( NULL != p_strip ) && ( i < strip_chars ); i++ )
+				{
+					ili9488_driver_rasterise_char( *str++, p_font, &p_strip[ i * char_pixels ], fg_rgb, bg_rgb );
+				}
+			#endif
+			ch_num -= strip_chars;
+
+			// Arena stayed full
+			if ( NULL == p_strip )
+			{
+				status = eILI9488_ERROR;
+			}
+			else if ( first_strip )
+			{
+				// One window for the whole string, sent with the first strip
+				ili9488_queue_begin();
+				status |= ili9488_driver_set_cursor( col, col + p_font->height - 1, page, page + (( strip_chars + ch_num ) * p_font->width ) - 1);
+				status |= ili9488_low_if_write_rgb_to_gram( p_strip, strip_chars * char_pixels, true);
+				ili9488_queue_end();
+				first_strip = false;
+			}
+			else
+			{
+				status |= ili9488_low_if_continue_rgb_to_gram( p_strip, strip_chars * char_pixels );
+			}
+			ili9488_glyph_cache_pin( p_strip, ili9488_queue_get_ticket());
+		}
 	}
 
 	return status;
@@ -0,0 +1,272 @@
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      ili9488_glyph_cache.c
+*@brief     Cache of rasterised RGB565 glyphs
+*@author    Leon Farchau
+*@date      17.10.2026
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup ILI9488_GLYPH_CACHE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Cache of rasterised RGB565 glyphs
+*
+* 	Glyphs are kept in GRAM order, ready to be sent by DMA, and are
+* 	keyed by char, font and colour pair. ILI9488_GLYPH_CACHE_SIZE bytes
+* 	are split into slots that fit the largest font, when all are taken
+* 	the least recently used glyph is replaced.
+*
+* 	Glyphs are sent by reference from the display queue. Each slot is
+* 	pinned with the ticket of its last push and is only replaced once
+* 	the queue has sent it.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "ili9488_glyph_cache.h"
+#include "ili9488_font.h"
+#include "ili9488_queue.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#if ( ILI9488_GLYPH_CACHE_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Pixels of one slot
+#define ILI9488_GLYPH_CACHE_SLOT_PIXELS		( ILI9488_MAX_FONT_WIDTH * ILI9488_MAX_FONT_HEIGHT )
+
+// Number of slots
+#define ILI9488_GLYPH_CACHE_SLOTS			( ILI9488_GLYPH_CACHE_SIZE / ( ILI9488_GLYPH_CACHE_SLOT_PIXELS * 2U ))
+
+#if ( ILI9488_GLYPH_CACHE_SLOTS < 2 )
+	#error "ILI9488_GLYPH_CACHE_SIZE must hold at least two glyphs of the largest font"
+#endif
+
+/**
+ * 	Glyph slot
+ */
+typedef struct
+{
+	uint32_t	last_use;	/**<Tick of the last lookup, 0 for an empty slot */
+	uint32_t	ticket;		/**<Queue ticket of the last push */
+	uint16_t	fg_rgb;		/**<Foreground color */
+	uint16_t	bg_rgb;		/**<Background color */
+	uint8_t		ch;			/**<Character */
+	uint8_t		font_opt;	/**<Font */
+} ili9488_glyph_slot_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t						g_glyphPixels[ ILI9488_GLYPH_CACHE_SLOTS ][ ILI9488_GLYPH_CACHE_SLOT_PIXELS ];
+static ili9488_glyph_slot_t			g_glyphSlots[ ILI9488_GLYPH_CACHE_SLOTS ];
+static uint32_t						g_glyphTick = 0;
+static ili9488_glyph_cache_stats_t	g_glyphStats;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find glyph in cache
+*
+* @param[in] 	ch - Character
+* @param[in] 	font_opt - Font
+* @param[in] 	fg_rgb - Foreground color in RGB565
+* @param[in] 	bg_rgb - Background color in RGB565
+* @return		p_pixels - Pixels of the glyph, NULL if not cached
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint16_t * ili9488_glyph_cache_find(const uint8_t ch, const ili9488_font_opt_t font_opt, const uint16_t fg_rgb, const uint16_t bg_rgb)
+{
+	uint32_t i;
+
+	for ( i = 0; i < ILI9488_GLYPH_CACHE_SLOTS; i++ )
+	{
+		if 	(	( 0U != g_glyphSlots[i].last_use )
+			&&	( ch == g_glyphSlots[i].ch )
+			&&	( font_opt == g_glyphSlots[i].font_opt )
+			&&	( fg_rgb == g_glyphSlots[i].fg_rgb )
+			&&	( bg_rgb == g_glyphSlots[i].bg_rgb ))
+		{
+			g_glyphSlots[i].last_use = ++g_glyphTick;
+			g_glyphStats.hits++;
+			return g_glyphPixels[i];
+		}
+	}
+
+	g_glyphStats.misses++;
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Take slot for a new glyph
+*
+*	Replaces the least recently used glyph, the caller has to
+*	rasterise the glyph into the returned pixels.
+*
+* @param[in] 	ch - Character
+* @param[in] 	font_opt - Font
+* @param[in] 	fg_rgb - Foreground color in RGB565
+* @param[in] 	bg_rgb - Background color in RGB565
+* @return		p_pixels - Pixels of the slot, NULL if the replaced glyph is
+* 							still queued after ILI9488_QUEUE_TIMEOUT_US
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint16_t * ili9488_glyph_cache_insert(const uint8_t ch, const ili9488_font_opt_t font_opt, const uint16_t fg_rgb, const uint16_t bg_rgb)
+{
+	ili9488_status_t 	status 		= eILI9488_OK;
+	uint16_t *			p_pixels 	= NULL;
+	uint32_t 			i;
+	uint32_t 			lru 		= 0;
+
+	for ( i = 1; i < ILI9488_GLYPH_CACHE_SLOTS; i++ )
+	{
+		if ( g_glyphSlots[i].last_use < g_glyphSlots[lru].last_use )
+		{
+			lru = i;
+		}
+	}
+
+	if ( 0U != g_glyphSlots[lru].last_use )
+	{
+		// Glyph may still be queued
+		status = ili9488_queue_wait( g_glyphSlots[lru].ticket );
+
+		if ( eILI9488_OK == status )
+		{
+			g_glyphStats.evictions++;
+		}
+	}
+
+	if ( eILI9488_OK == status )
+	{
+		g_glyphSlots[lru].last_use 	= ++g_glyphTick;
+		g_glyphSlots[lru].ch 		= ch;
+		g_glyphSlots[lru].font_opt 	= (uint8_t) font_opt;
+		g_glyphSlots[lru].fg_rgb 	= fg_rgb;
+		g_glyphSlots[lru].bg_rgb 	= bg_rgb;
+
+		p_pixels = g_glyphPixels[lru];
+	}
+
+	return p_pixels;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Pin glyph until it is sent
+*
+* @param[in] 	p_pixels - Pixels of the glyph
+* @param[in] 	ticket - Queue ticket of the push
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void ili9488_glyph_cache_pin(const uint16_t * const p_pixels, const uint32_t ticket)
+{
+	g_glyphSlots[( p_pixels - g_glyphPixels[0] ) / ILI9488_GLYPH_CACHE_SLOT_PIXELS ].ticket = ticket;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Drop all glyphs
+*
+*	The glyphs are kept if the queue does not get empty within
+*	ILI9488_QUEUE_TIMEOUT_US.
+*
+* @return		status - Either Ok or Error on timeout
+*/
+////////////////////////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_glyph_cache_flush(void)
+{
+	ili9488_status_t status;
+
+	// A glyph may still be queued
+	status = ili9488_queue_flush();
+
+	if ( eILI9488_OK == status )
+	{
+		memset( g_glyphSlots, 0, sizeof( g_glyphSlots ));
+		g_glyphTick = 0;
+	}
+
+	return status;
+}
+
+#else
+
+uint16_t * ili9488_glyph_cache_find(const uint8_t ch, const ili9488_font_opt_t font_opt, const uint16_t fg_rgb, const uint16_t bg_rgb)
+{
+	(void) ch;
+	(void) font_opt;
+	(void) fg_rgb;
+	(void) bg_rgb;
+
+	return NULL;
+}
+
+uint16_t * ili9488_glyph_cache_insert(const uint8_t ch, const ili9488_font_opt_t font_opt, const uint16_t fg_rgb, const uint16_t bg_rgb)
+{
+	(void) ch;
+	(void) font_opt;
+	(void) fg_rgb;
+	(void) bg_rgb;
+
+	return NULL;
+}
+
+void ili9488_glyph_cache_pin(const uint16_t * const p_pixels, const uint32_t ticket)
+{
+	(void) p_pixels;
+	(void) ticket;
+}
+
+ili9488_status_t ili9488_glyph_cache_flush(void)
+{
+	return eILI9488_OK;
+}
+
+static ili9488_glyph_cache_stats_t	g_glyphStats;
+
+#endif // ILI9488_GLYPH_CACHE_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get hit and miss counters
+*
+* @param[out] 	p_stats - Statistics
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void ili9488_glyph_cache_get_stats(ili9488_glyph_cache_stats_t * const p_stats)
+{
+	*p_stats = g_glyphStats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reset hit and miss counters
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void ili9488_glyph_cache_reset_stats(void)
+{
+	memset( &g_glyphStats, 0, sizeof( g_glyphStats ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      ili9488_glyph_cache.h
+*@brief     Cache of rasterised RGB565 glyphs
+*@author    Leon Farchau
+*@date      17.10.2026
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup ILI9488_GLYPH_CACHE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Cache of rasterised RGB565 glyphs
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _ILI9488_GLYPH_CACHE_H_
+#define _ILI9488_GLYPH_CACHE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "ili9488_cfg.h"
+#include "ili9488_types.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Glyph cache statistics
+ */
+typedef struct
+{
+	uint32_t hits;		/**<Glyphs sent straight from the cache */
+	uint32_t misses;	/**<Glyphs that had to be rasterised */
+	uint32_t evictions;	/**<Glyphs replaced to make room */
+} ili9488_glyph_cache_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+uint16_t * 	ili9488_glyph_cache_find		(const uint8_t ch, const ili9488_font_opt_t font_opt, const uint16_t fg_rgb, const uint16_t bg_rgb);
+uint16_t * 	ili9488_glyph_cache_insert		(const uint8_t ch, const ili9488_font_opt_t font_opt, const uint16_t fg_rgb, const uint16_t bg_rgb);
+void		ili9488_glyph_cache_pin			(const uint16_t * const p_pixels, const uint32_t ticket);
+ili9488_status_t ili9488_glyph_cache_flush	(void);
+void		ili9488_glyph_cache_get_stats	(ili9488_glyph_cache_stats_t * const p_stats);
+void		ili9488_glyph_cache_reset_stats	(void);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifdef __cplusplus
+}
+#endif // extern "C"
+#endif // _ILI9488_GLYPH_CACHE_H_
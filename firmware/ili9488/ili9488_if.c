@@ -27,6 +27,8 @@
 // Includes
 ////////////////////////////////////////////////////////////////////////////////
 #include "ili9488_if.h"
+#include "ili9488_if_dma.h"
+#include "ili9488_queue.h"
 #include "pico/stdlib.h"
 
 // USER INCLUDES BEGIN...
@@ -35,6 +37,7 @@
 #include "hardware/gpio.h"
 #include "hardware/pwm.h"
 #include "hardware/dma.h"
+#include "hardware/irq.h"
 
 // USER INCLUDES END...
 
@@ -46,6 +49,20 @@ extern const uint DEBUG2_PIN;
 extern const uint DEBUG3_PIN;
 extern const uint DEBUG4_PIN;
 
+/**
+ * 	DMA control block, loaded into the alias 1 registers of the data channel
+ */
+typedef struct
+{
+	uint32_t ctrl;
+	uint32_t read_addr;
+	uint32_t write_addr;
+	uint32_t transfer_count;
+} ili9488_if_dma_block_t;
+
+// Segments need up to three blocks (wait for RX, DC, data) plus the null block
+#define ILI9488_IF_CHAIN_BLOCKS		( 3U * ILI9488_IF_CHAIN_SEGMENTS + 1U )
+
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
@@ -55,11 +72,25 @@ uint32_t g_dmaChannel = 0;
 uint32_t g_dmaSrc = 0;
 dma_channel_config g_dmaConfig;
 uint32_t g_constData = 0; //Used for non-incrementing DMA transfers
+uint32_t g_lockDepth = 0; //Nesting of ili9488_if_lock()
+
+// Chained transfers
+uint32_t g_dmaCtrlChannel = 0;
+dma_channel_config g_dmaCtrlConfig;
+uint32_t g_chainCtrlTx[2] = { 0, 0 }; //Block control for data, without and with increment
+uint32_t g_chainCtrlRx = 0; //Block control for waiting on the RX FIFO
+uint32_t g_chainCtrlDc = 0; //Block control for DC line
+uint32_t g_chainDc[2] = { 0, 0 }; //GPIO control of DC line, low and high
+uint16_t g_chainDiscard = 0; //Received data of a chain
+uint32_t g_chainPauseAddr = 0; //Chain can be paused once its control channel passed this
+ili9488_if_dma_block_t g_chainBlocks[ ILI9488_IF_CHAIN_BLOCKS ];
 
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
 ili9488_status_t ili9488_if_dma_init(void);
+void ili9488_if_dma_irq_handler(void);
+uint32_t ili9488_if_chain_ctrl(const enum dma_channel_transfer_size size, const bool incrementSrc, const uint dreq);
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -159,13 +190,14 @@ void ili9488_if_set_dc(const bool state)
 {
 	// USER CODE BEGIN...
 
+	// Driven by output override, DMA chains write it the same way
 	if ( true == state )
 	{
-		gpio_put( eGPIO_D_DC, eGPIO_HIGH );
+		gpio_set_outover( eGPIO_D_DC, GPIO_OVERRIDE_HIGH );
 	}
 	else
 	{
-		gpio_put( eGPIO_D_DC, eGPIO_LOW );
+		gpio_set_outover( eGPIO_D_DC, GPIO_OVERRIDE_LOW );
 	}
 
 	// USER CODE END...
@@ -251,10 +283,12 @@ ili9488_status_t ili9488_if_spi_transmit(const uint16_t * p_data, const uint32_t
 	ili9488_if_resume_dma();
 	
 
-	// wait if transfer is not finished for blocking mode
+	// wait if transfer is not finished for blocking mode, it was waited
+	// for and shall not report its completion to the queue
 	if ( true == blocking )
 	{
 		ili9488_if_wait_for_ready();
+		dma_hw->ints1 = 1u << g_dmaChannel;
 	}
 
 	return status;
@@ -285,6 +319,108 @@ ili9488_status_t ili9488_if_spi_transmit_8b(const uint8_t * p_data, const uint32
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Transmit chain of segments via SPI
+*
+*	All segments are sent by one chain of DMA control blocks, the
+*	completion interrupt is raised once after the last one. Between
+*	segments the chain waits until the RX FIFO received all data of
+*	the previous segment, so DC is only switched once the SPI is idle.
+*
+* @note	Only the last segment may be longer than ILI9488_IF_CHAIN_SEGMENT_MAX.
+*
+* @param[in]	p_segments	- Segments to transmit
+* @param[in]	count 		- Number of segments
+* @return		status 		- Status of transmittion
+*/
+////////////////////////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_if_spi_transmit_chain(const ili9488_if_segment_t * p_segments, const uint32_t count)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_if_dma_block_t * p_block = g_chainBlocks;
+	uint32_t i;
+
+	if (( 0U == count ) || ( count > ILI9488_IF_CHAIN_SEGMENTS ))
+	{
+		status = eILI9488_ERROR;
+	}
+
+	for ( i = 0; ( i + 1U ) < count; i++ )
+	{
+		if ( p_segments[i].size > ILI9488_IF_CHAIN_SEGMENT_MAX )
+		{
+			status = eILI9488_ERROR;
+		}
+	}
+
+	if ( eILI9488_OK == status )
+	{
+		// USER CODE BEGIN...
+
+		// wait if previous transfer is not finished
+		ili9488_if_wait_for_ready();
+
+		// RX FIFO shall only count data of this chain
+		while(spi_is_readable(eGPIO_SPI))
+		{
+			g_chainDiscard = spi_get_hw(eGPIO_SPI)->dr;
+		}
+
+		ili9488_if_set_dc( p_segments[0].dc );
+		ili9488_if_set_cs( true );
+		ili9488_if_set_cs( false );
+
+		for ( i = 0; i < count; i++ )
+		{
+			if ( i > 0U )
+			{
+				// Wait until previous segment is shifted out
+				p_block->ctrl = g_chainCtrlRx;
+				p_block->read_addr = (uint32_t) &spi_get_hw(eGPIO_SPI)->dr;
+				p_block->write_addr = (uint32_t) &g_chainDiscard;
+				p_block->transfer_count = p_segments[i - 1U].size;
+				p_block++;
+
+				if ( p_segments[i].dc != p_segments[i - 1U].dc )
+				{
+					p_block->ctrl = g_chainCtrlDc;
+					p_block->read_addr = (uint32_t) &g_chainDc[ p_segments[i].dc ];
+					p_block->write_addr = (uint32_t) &io_bank0_hw->io[eGPIO_D_DC].ctrl;
+					p_block->transfer_count = 1U;
+					p_block++;
+				}
+			}
+
+			p_block->ctrl = g_chainCtrlTx[ p_segments[i].increment ];
+			p_block->read_addr = (uint32_t) p_segments[i].p_data;
+			p_block->write_addr = (uint32_t) &spi_get_hw(eGPIO_SPI)->dr;
+			p_block->transfer_count = p_segments[i].size;
+			p_block++;
+		}
+
+		// Last segment needs no DC change and may be paused
+		g_chainPauseAddr = (uint32_t) p_block;
+
+		// Null block ends the chain and raises the interrupt
+		p_block->ctrl = g_chainCtrlDc;
+		p_block->read_addr = 0U;
+		p_block->write_addr = 0U;
+		p_block->transfer_count = 0U;
+
+		dma_channel_configure(g_dmaCtrlChannel, &g_dmaCtrlConfig,
+							  &dma_hw->ch[g_dmaChannel].al1_ctrl,	// write address
+							  g_chainBlocks,						// read address
+							  4U, 									// one block
+							  true									// start immediately
+		);
+
+		// USER CODE END...
+	}
+
+	return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 *		Receive bytes via SPI
@@ -356,9 +492,72 @@ ili9488_status_t ili9488_if_dma_init(void)
     channel_config_set_write_increment(&g_dmaConfig, false);
     channel_config_set_dreq(&g_dmaConfig, spi_get_dreq(eGPIO_SPI, true));
 
+	// Control channel loads one block per data transfer into the data channel
+	g_dmaCtrlChannel = dma_claim_unused_channel(true);
+	g_dmaCtrlConfig = dma_channel_get_default_config(g_dmaCtrlChannel);
+	channel_config_set_transfer_data_size(&g_dmaCtrlConfig, DMA_SIZE_32);
+	channel_config_set_read_increment(&g_dmaCtrlConfig, true);
+	channel_config_set_write_increment(&g_dmaCtrlConfig, true);
+	channel_config_set_ring(&g_dmaCtrlConfig, true, 4);
+
+	g_chainCtrlTx[0] = ili9488_if_chain_ctrl(DMA_SIZE_16, false, spi_get_dreq(eGPIO_SPI, true));
+	g_chainCtrlTx[1] = ili9488_if_chain_ctrl(DMA_SIZE_16, true, spi_get_dreq(eGPIO_SPI, true));
+	g_chainCtrlRx = ili9488_if_chain_ctrl(DMA_SIZE_16, false, spi_get_dreq(eGPIO_SPI, false));
+	g_chainCtrlDc = ili9488_if_chain_ctrl(DMA_SIZE_32, false, DREQ_FORCE);
+
+	g_chainDc[0] = ( GPIO_FUNC_SIO << IO_BANK0_GPIO0_CTRL_FUNCSEL_LSB ) | ( GPIO_OVERRIDE_LOW << IO_BANK0_GPIO0_CTRL_OUTOVER_LSB );
+	g_chainDc[1] = ( GPIO_FUNC_SIO << IO_BANK0_GPIO0_CTRL_FUNCSEL_LSB ) | ( GPIO_OVERRIDE_HIGH << IO_BANK0_GPIO0_CTRL_OUTOVER_LSB );
+
+	// Completion drains the queue, DMA_IRQ_0 is taken by the DAC on the
+	// other core. The IRQ is enabled on the core calling this.
+	dma_channel_set_irq1_enabled(g_dmaChannel, true);
+	irq_set_exclusive_handler(DMA_IRQ_1, ili9488_if_dma_irq_handler);
+	irq_set_enabled(DMA_IRQ_1, true);
+
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+ *  	  Control of a chained data block
+ * 
+ * 		Blocks chain back to the control channel and only the null
+ * 		block at the end raises the interrupt.
+ */
+////////////////////////////////////////////////////////////////////////////////
+uint32_t ili9488_if_chain_ctrl(const enum dma_channel_transfer_size size, const bool incrementSrc, const uint dreq)
+{
+	dma_channel_config config = dma_channel_get_default_config(g_dmaChannel);
+	channel_config_set_transfer_data_size(&config, size);
+	channel_config_set_read_increment(&config, incrementSrc);
+	channel_config_set_write_increment(&config, false);
+	channel_config_set_dreq(&config, dreq);
+	channel_config_set_chain_to(&config, g_dmaCtrlChannel);
+	channel_config_set_irq_quiet(&config, true);
+
+	return channel_config_get_ctrl_value(&config);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+ *  	  DMA completion interrupt
+ * 
+ * 		A chain raises it with its null block, blocking transfers
+ * 		acknowledge it themselves. Only a finished channel is reported
+ * 		and the queue ignores what it did not start.
+ */
+////////////////////////////////////////////////////////////////////////////////
+void ili9488_if_dma_irq_handler(void)
+{
+	dma_hw->ints1 = 1u << g_dmaChannel;
+
+	if(!dma_channel_is_busy(g_dmaChannel))
+	{
+		ili9488_queue_transfer_done();
+	}
+	return;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
  *  	  Checks if transaction is in progress
@@ -369,7 +568,7 @@ ili9488_status_t ili9488_if_dma_init(void)
 ////////////////////////////////////////////////////////////////////////////////
 bool ili9488_if_dma_busy( void )
 {
-	return dma_channel_is_busy(g_dmaChannel) || spi_is_busy(eGPIO_SPI);
+	return dma_channel_is_busy(g_dmaChannel) || dma_channel_is_busy(g_dmaCtrlChannel) || spi_is_busy(eGPIO_SPI);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -386,15 +585,50 @@ void ili9488_if_wait_for_ready( void )
 	return;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * 	  Holds off the DMA interrupt, calls can be nested
+ */
+////////////////////////////////////////////////////////////////////////////////
+void ili9488_if_lock( void )
+{
+	irq_set_enabled(DMA_IRQ_1, false);
+	g_lockDepth++;
+	return;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * 	  Releases the DMA interrupt after the outermost lock
+ */
+////////////////////////////////////////////////////////////////////////////////
+void ili9488_if_unlock( void )
+{
+	if(0 == --g_lockDepth)
+	{
+		irq_set_enabled(DMA_IRQ_1, true);
+	}
+	return;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
  * 	  Pauses DMA transfer
+ * 		The queue is held off until the transfer is resumed. A chain
+ * 		is only paused in its last segment, the DC changes before
+ * 		wait on the RX FIFO that is drained here. Only a busy channel
+ * 		is touched, the control channel may load the null block.
  */
 ////////////////////////////////////////////////////////////////////////////////
 void ili9488_if_pause_dma( void )
 {
 	volatile uint32_t dummy;
-	dma_hw->ch[g_dmaChannel].ctrl_trig &= ~0x1;
+	ili9488_if_lock();
+	while((dma_hw->ch[g_dmaCtrlChannel].read_addr < g_chainPauseAddr) || dma_channel_is_busy(g_dmaCtrlChannel)){};
+	if(dma_channel_is_busy(g_dmaChannel))
+	{
+		dma_hw->ch[g_dmaChannel].ctrl_trig &= ~0x1;
+	}
 	while(spi_is_busy(eGPIO_SPI)){};
 	while(spi_is_readable(eGPIO_SPI))
 	{
@@ -416,6 +650,7 @@ void ili9488_if_resume_dma( void )
 	{
 		dma_hw->ch[g_dmaChannel].ctrl_trig |= 0x1;
 	}
+	ili9488_if_unlock();
 	return;
 }
 
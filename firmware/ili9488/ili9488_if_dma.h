@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      ili9488_if_dma.h
+*@brief     DMA extension of the ILI9488 interface for the transfer queue
+*@author    Leon Farchau
+*@date      17.10.2026
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup ILI9488_IF
+* @{ <!-- BEGIN GROUP -->
+*
+* 	DMA extension of the ILI9488 interface for the transfer queue
+*
+* 	Chained transfers and locking against the DMA interrupt, implemented
+* 	next to the rest of the interface in ili9488_if.c.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _ILI9488_IF_DMA_H_
+#define _ILI9488_IF_DMA_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "ili9488_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Segments of one chained transfer
+#define ILI9488_IF_CHAIN_SEGMENTS		( 8U )
+
+// Longest segment followed by a DC change, depth of the SPI FIFOs
+#define ILI9488_IF_CHAIN_SEGMENT_MAX	( 8U )
+
+/**
+ * 	Segment of a chained transfer
+ */
+typedef struct
+{
+	const uint16_t *	p_data;		/**<Data, 8 bit parameters are zero-extended */
+	uint32_t			size;		/**<Number of data */
+	bool				dc;			/**<DC line, true for data */
+	bool				increment;	/**<Increment source, false repeats p_data[0] */
+} ili9488_if_segment_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+void 				ili9488_if_lock             (void);
+void 				ili9488_if_unlock           (void);
+ili9488_status_t 	ili9488_if_spi_transmit_chain(const ili9488_if_segment_t * p_segments, const uint32_t count);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifdef __cplusplus
+}
+#endif
+#endif // _ILI9488_IF_DMA_H_
@@ -23,6 +23,9 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include "ili9488_low_if.h"
 #include "ili9488_if.h"
+#include "ili9488_queue.h"
+
+#include <stddef.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
@@ -62,6 +65,9 @@
 *	If sending only command, size shall be 0. Add size only
 *	for data bytes.
 *
+*	Commands with up to ILI9488_QUEUE_MAX_PARAMS data bytes are
+*	queued, longer ones are sent once the queue is empty.
+*
 * @param[in]	cmd 		- Command name
 * @param[in]	tx_data 	- Pointer to transmit data
 * @param[in]	size 		- Number of data to transmit
@@ -73,25 +79,31 @@ ili9488_status_t ili9488_low_if_write_register(const ili9488_cmd_t cmd, const ui
 	ili9488_status_t 	status 	= eILI9488_OK;
 	uint16_t 			command = cmd;
 
+	if ( size <= ILI9488_QUEUE_MAX_PARAMS )
+	{
+		status = ili9488_queue_push_command( cmd, tx_data, size );
+	}
 	// Wait for previous operation to finish
-	ili9488_if_wait_for_ready();
-	ILI9488_LOW_IF_CS_HIGH();
-
-	// Set CS & DC
-	ILI9488_LOW_IF_CS_LOW();
-	ILI9488_LOW_IF_DC_COMMAND();
-
-	// Send command
-	if ( eILI9488_OK != ili9488_if_spi_transmit( &command, 1U, 1, 1 ))
+	else if ( eILI9488_OK != ili9488_queue_flush())
 	{
 		status = eILI9488_ERROR;
 	}
-
-	// Command send OK
 	else
 	{
-		// In case of parameters send them as well
-		if ( size > 0 )
+		ILI9488_LOW_IF_CS_HIGH();
+
+		// Set CS & DC
+		ILI9488_LOW_IF_CS_LOW();
+		ILI9488_LOW_IF_DC_COMMAND();
+
+		// Send command
+		if ( eILI9488_OK != ili9488_if_spi_transmit( &command, 1U, 1, 1 ))
+		{
+			status = eILI9488_ERROR;
+		}
+
+		// Command send OK
+		else
 		{
 			// Data transmit
 			ILI9488_LOW_IF_DC_DATA();
@@ -101,10 +113,10 @@ ili9488_status_t ili9488_low_if_write_register(const ili9488_cmd_t cmd, const ui
 				status = eILI9488_ERROR;
 			}
 		}
-	}
 
-	// Set CS
-	ILI9488_LOW_IF_CS_HIGH();
+		// Set CS
+		ILI9488_LOW_IF_CS_HIGH();
+	}
 
 	return status;
 }
@@ -125,37 +137,43 @@ ili9488_status_t ili9488_low_if_read_register(const ili9488_cmd_t cmd, uint8_t *
 	uint16_t 			command = cmd;
 
 	// Wait for previous operation to finish
-	ili9488_if_wait_for_ready();
-	ILI9488_LOW_IF_CS_HIGH();
-
-	// Set CS & DC
-	ILI9488_LOW_IF_CS_LOW();
-	ILI9488_LOW_IF_DC_COMMAND();
-
-	// Send command
-	if ( eILI9488_OK != ili9488_if_spi_transmit( &command, 1U, 1, 1 ))
+	if ( eILI9488_OK != ili9488_queue_flush())
 	{
 		status = eILI9488_ERROR;
 	}
-
-	// Command send OK
 	else
 	{
-		// In case of parameters send them as well
-		if ( size > 0 )
+		ILI9488_LOW_IF_CS_HIGH();
+
+		// Set CS & DC
+		ILI9488_LOW_IF_CS_LOW();
+		ILI9488_LOW_IF_DC_COMMAND();
+
+		// Send command
+		if ( eILI9488_OK != ili9488_if_spi_transmit( &command, 1U, 1, 1 ))
 		{
-			// Data transmit
-			ILI9488_LOW_IF_DC_DATA();
+			status = eILI9488_ERROR;
+		}
 
-			if ( eILI9488_OK != ili9488_if_spi_receive_8b( rx_data, size ))
+		// Command send OK
+		else
+		{
+			// In case of parameters send them as well
+			if ( size > 0 )
 			{
-				status = eILI9488_ERROR;
+				// Data transmit
+				ILI9488_LOW_IF_DC_DATA();
+
+				if ( eILI9488_OK != ili9488_if_spi_receive_8b( rx_data, size ))
+				{
+					status = eILI9488_ERROR;
+				}
 			}
 		}
-	}
 
-	// Set CS
-	ILI9488_LOW_IF_CS_HIGH();
+		// Set CS
+		ILI9488_LOW_IF_CS_HIGH();
+	}
 
 	return status;
 }
@@ -167,6 +185,10 @@ ili9488_status_t ili9488_low_if_read_register(const ili9488_cmd_t cmd, uint8_t *
 *	This function writes constant RGB code and write size
 *	number pixels.
 *
+*	Transfer is queued and the function returns at once. A constant
+*	RGB code is copied, incremented RGB codes are sent by reference
+*	and must stay valid until the queue has sent them.
+*
 * @param[in]	p_rgb 	- Pointer to rgb code
 * @param[in]	size 	- Number of data to transmit
 * @param[in]	increment - Increment address after each write
@@ -175,39 +197,41 @@ ili9488_status_t ili9488_low_if_read_register(const ili9488_cmd_t cmd, uint8_t *
 ////////////////////////////////////////////////////////////////////////////////
 ili9488_status_t ili9488_low_if_write_rgb_to_gram(uint16_t * const p_rgb, const uint32_t size, const bool increment)
 {
-			ili9488_status_t 	status 	= eILI9488_OK;
-	const 	uint16_t 		 	cmd 	= eILI9488_WRITE_MEM_CMD;
-			uint32_t 			i		= 0UL;
-
-	// Wait for previous operation to finish
-	ili9488_if_wait_for_ready();
-	ILI9488_LOW_IF_CS_HIGH();
-
-	// Set CS & DC
-	ILI9488_LOW_IF_CS_LOW();
-	ILI9488_LOW_IF_DC_COMMAND();
+	ili9488_status_t status = eILI9488_OK;
 
 	// Send command
-	if ( eILI9488_OK != ili9488_if_spi_transmit((uint16_t*) &cmd, 1U, 1, 1 ))
+	status |= ili9488_queue_push_command( eILI9488_WRITE_MEM_CMD, NULL, 0U );
+
+	// Data transmit
+	if ( true == increment )
 	{
-		status = eILI9488_ERROR;
+		status |= ili9488_queue_push_pixels( p_rgb, size );
 	}
 	else
 	{
-		// In case of parameters send them as well
-		if ( size > 0 )
-		{
-			// Data transmit
-			ILI9488_LOW_IF_DC_DATA();
-
-			ili9488_if_spi_transmit((uint16_t*) p_rgb, size, increment, 0 );
-		}
+		status |= ili9488_queue_push_fill( *p_rgb, size );
 	}
 
 	return status;
 }
 
-
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Continue writing RGB codes to GRAM
+*
+*	Sends further pixels of a memory write started with
+*	ili9488_low_if_write_rgb_to_gram(), without a new command
+*	the display keeps filling the same address window.
+*
+* @param[in]	p_rgb 	- Pointer to rgb codes
+* @param[in]	size 	- Number of data to transmit
+* @return		status 	- Either Ok or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_continue_rgb_to_gram(uint16_t * const p_rgb, const uint32_t size)
+{
+	return ili9488_queue_push_pixels( p_rgb, size );
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
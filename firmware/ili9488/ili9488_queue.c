@@ -0,0 +1,679 @@
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      ili9488_queue.c
+*@brief     Queue of display transfers drained by the DMA interrupt
+*@author    Leon Farchau
+*@date      17.10.2026
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup ILI9488_QUEUE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Queue of display transfers drained by the DMA interrupt
+*
+* 	Commands, colour fills and pixel buffers are appended to a ring and
+* 	the caller returns at once. Queued commands up to and including the
+* 	next fill or pixel buffer are sent as one chain of DMA control
+* 	blocks, DC is switched by the chain. Its completion interrupt starts
+* 	the next chain. A transaction keeps the ops pushed between
+* 	ili9488_queue_begin() and ili9488_queue_end() from being started
+* 	one by one, so an address window and its pixels take one chain.
+*
+* 	Commands and fill colours are copied into the ring, pixels are sent
+* 	by reference. Pixels that are built on the fly shall be placed in
+* 	the arena with ili9488_queue_alloc(), it is released in order as the
+* 	transfers finish. Other pixel buffers must stay valid until the
+* 	ticket of their push is done.
+*
+* 	The caller only blocks when the ring or the arena is full, for at
+* 	most ILI9488_QUEUE_TIMEOUT_US. The push or allocation fails after it.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "ili9488_queue.h"
+#include "ili9488_if.h"
+#include "ili9488_if_dma.h"
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#if (( ILI9488_QUEUE_LENGTH & ( ILI9488_QUEUE_LENGTH - 1U )) || ( ILI9488_QUEUE_LENGTH < 2U ))
+	#error "ILI9488_QUEUE_LENGTH must be a power of two"
+#endif
+
+// Pixels of the arena
+#define ILI9488_QUEUE_ARENA_PIXELS		( ILI9488_QUEUE_ARENA_SIZE / 2U )
+
+// Parameter words of one chain
+#define ILI9488_QUEUE_CHAIN_WORDS		( ILI9488_IF_CHAIN_SEGMENTS * ILI9488_IF_CHAIN_SEGMENT_MAX )
+
+// Segments of a command, its parameters are split into segments the FIFO takes
+#define ILI9488_QUEUE_CMD_SEGMENTS(n)	( 1U + ((( n ) + ILI9488_IF_CHAIN_SEGMENT_MAX - 1U ) / ILI9488_IF_CHAIN_SEGMENT_MAX ))
+
+#if ( ILI9488_QUEUE_CMD_SEGMENTS( ILI9488_QUEUE_MAX_PARAMS ) > ILI9488_IF_CHAIN_SEGMENTS )
+	#error "ILI9488_QUEUE_MAX_PARAMS do not fit into one chain"
+#endif
+
+/**
+ * 	Queued operation types
+ */
+typedef enum
+{
+	eILI9488_QUEUE_OP_CMD = 0,		/**<Command with parameters */
+	eILI9488_QUEUE_OP_FILL,			/**<Same colour count times */
+	eILI9488_QUEUE_OP_PIXELS,		/**<Pixel buffer */
+} ili9488_queue_op_type_t;
+
+/**
+ * 	Queued operation
+ */
+typedef struct
+{
+	const uint16_t *		p_pixels;		/**<Pixels, only for pixel buffers */
+	uint32_t				count;			/**<Pixels or parameter bytes */
+	uint32_t				arena_end;		/**<Arena released once done */
+	uint16_t				value;			/**<Command or fill colour */
+	uint8_t					type;			/**<Operation type */
+	bool					arena;			/**<Pixels taken from the arena */
+	uint8_t					params[ ILI9488_QUEUE_MAX_PARAMS ];	/**<Command parameters */
+} ili9488_queue_op_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+static ili9488_queue_op_t	g_queueOps[ ILI9488_QUEUE_LENGTH ];
+static volatile uint32_t	g_queueHead 	= 0;	/**<Operations pushed, written by caller */
+static volatile uint32_t	g_queueTail 	= 0;	/**<Operations done, written by interrupt */
+static volatile bool		g_queueInFlight = false;
+static uint32_t				g_queueHold 	= 0;	/**<Nesting of transactions */
+
+static ili9488_if_segment_t	g_chainSegments[ ILI9488_IF_CHAIN_SEGMENTS ];
+static uint16_t				g_chainWords[ ILI9488_QUEUE_CHAIN_WORDS ];
+static uint32_t				g_chainOps 		= 0;	/**<Operations of the chain in flight */
+
+static uint16_t				g_queueArena[ ILI9488_QUEUE_ARENA_PIXELS ];
+static uint32_t				g_arenaHead 	= 0;	/**<End of last allocation */
+static uint32_t				g_arenaStart 	= 0;	/**<Head before last allocation */
+static volatile uint32_t	g_arenaTail 	= 0;	/**<End of released pixels, written by interrupt */
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static ili9488_queue_op_t *	ili9488_queue_reserve	(void);
+static void					ili9488_queue_commit	(void);
+static void					ili9488_queue_release	(void);
+static void					ili9488_queue_run		(void);
+static void					ili9488_queue_start_chain(void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Push command
+*
+* @param[in]	cmd 		- Command
+* @param[in]	p_params 	- Parameters, copied into the queue
+* @param[in]	size 		- Number of parameters, at most ILI9488_QUEUE_MAX_PARAMS
+* @return		status 		- Either Ok or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_queue_push_command(const ili9488_cmd_t cmd, const uint8_t * const p_params, const uint32_t size)
+{
+	ili9488_status_t 		status = eILI9488_OK;
+	ili9488_queue_op_t *	p_op;
+
+	if ( size > ILI9488_QUEUE_MAX_PARAMS )
+	{
+		status = eILI9488_ERROR;
+	}
+	else
+	{
+		p_op = ili9488_queue_reserve();
+
+		if ( NULL == p_op )
+		{
+			status = eILI9488_ERROR;
+		}
+		else
+		{
+			p_op->type 	= eILI9488_QUEUE_OP_CMD;
+			p_op->value = (uint16_t) cmd;
+			p_op->count = size;
+
+			if ( size > 0U )
+			{
+				memcpy( p_op->params, p_params, size );
+			}
+
+			ili9488_queue_commit();
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Push colour fill
+*
+* @param[in]	color 	- Colour in RGB565
+* @param[in]	count 	- Number of pixels
+* @return		status 	- Either Ok or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_queue_push_fill(const uint16_t color, const uint32_t count)
+{
+	ili9488_status_t 		status = eILI9488_OK;
+	ili9488_queue_op_t *	p_op;
+
+	if ( count > 0U )
+	{
+		p_op = ili9488_queue_reserve();
+
+		if ( NULL == p_op )
+		{
+			status = eILI9488_ERROR;
+		}
+		else
+		{
+			p_op->type 	= eILI9488_QUEUE_OP_FILL;
+			p_op->value = color;
+			p_op->count = count;
+
+			ili9488_queue_commit();
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Push pixel buffer
+*
+* @note	Pixels are sent by reference, unless they were taken from the
+* 		arena they must stay valid until the ticket of this push is done.
+* 		Pixels of the arena are released if the push fails.
+*
+* @param[in]	p_pixels 	- Pixels in RGB565
+* @param[in]	count 		- Number of pixels
+* @return		status 		- Either Ok or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_queue_push_pixels(const uint16_t * const p_pixels, const uint32_t count)
+{
+	ili9488_status_t 		status = eILI9488_OK;
+	ili9488_queue_op_t *	p_op;
+
+	if ( count > 0U )
+	{
+		p_op = ili9488_queue_reserve();
+
+		if ( NULL == p_op )
+		{
+			status = eILI9488_ERROR;
+
+			// No op will release the allocation, give it back
+			if 	(	( p_pixels >= g_queueArena )
+				&&	( p_pixels < &g_queueArena[ ILI9488_QUEUE_ARENA_PIXELS ] ))
+			{
+				g_arenaHead = g_arenaStart;
+			}
+		}
+		else
+		{
+			p_op->type 		= eILI9488_QUEUE_OP_PIXELS;
+			p_op->p_pixels 	= p_pixels;
+			p_op->count 	= count;
+
+			// Pixels of the arena release it up to their allocation
+			if 	(	( p_pixels >= g_queueArena )
+				&&	( p_pixels < &g_queueArena[ ILI9488_QUEUE_ARENA_PIXELS ] ))
+			{
+				p_op->arena 	= true;
+				p_op->arena_end = g_arenaHead;
+			}
+
+			ili9488_queue_commit();
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Allocate pixels in the arena
+*
+*	Blocks until enough of the arena is released, at most for
+*	ILI9488_QUEUE_TIMEOUT_US. Pixels shall be pushed with
+*	ili9488_queue_push_pixels() before the next allocation.
+*
+* @param[in]	count 		- Number of pixels
+* @return		p_pixels 	- Pixels, NULL if larger than the arena or on timeout
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint16_t * ili9488_queue_alloc(const uint32_t count)
+{
+	uint16_t * 		p_pixels 	= NULL;
+	uint32_t		offset		= 0U;
+	uint32_t		skip		= 0U;
+	bool			full		= true;
+	bool			timeout		= false;
+	const uint32_t	start		= time_us_32();
+
+	if 	(	( count > 0U )
+		&&	( count <= ILI9488_QUEUE_ARENA_PIXELS ))
+	{
+		// Wait for transfers to release the pixels
+		while 	(	( true == full )
+				&&	( false == timeout ))
+		{
+			// Start over at the beginning of an idle arena
+			ili9488_if_lock();
+			if ( g_arenaTail == g_arenaHead )
+			{
+				g_arenaHead = 0U;
+				g_arenaTail = 0U;
+			}
+			ili9488_if_unlock();
+
+			// Allocation is never split, skip the rest of the arena
+			offset 	= g_arenaHead % ILI9488_QUEUE_ARENA_PIXELS;
+			skip 	= 0U;
+
+			if (( offset + count ) > ILI9488_QUEUE_ARENA_PIXELS )
+			{
+				skip 	= ILI9488_QUEUE_ARENA_PIXELS - offset;
+				offset 	= 0U;
+			}
+
+			full = (( g_arenaHead + skip + count - g_arenaTail ) > ILI9488_QUEUE_ARENA_PIXELS );
+
+			if ( true == full )
+			{
+				tight_loop_contents();
+				timeout = (( time_us_32() - start ) >= ILI9488_QUEUE_TIMEOUT_US );
+			}
+		}
+
+		if ( false == full )
+		{
+			g_arenaStart = g_arenaHead;
+			g_arenaHead += skip + count;
+			p_pixels = &g_queueArena[ offset ];
+		}
+	}
+
+	return p_pixels;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get ticket of the last pushed operation
+*
+* @return		ticket - Ticket
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t ili9488_queue_get_ticket(void)
+{
+	return g_queueHead;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if operations up to ticket are done
+*
+* @param[in]	ticket 	- Ticket
+* @return		true if done
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool ili9488_queue_is_done(const uint32_t ticket)
+{
+	const uint32_t tail = g_queueTail;
+
+	// Measured back from the head, old tickets never wrap into pending ones
+	return (( g_queueHead - ticket ) >= ( g_queueHead - tail ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait until operations up to ticket are done
+*
+*	Waits at most ILI9488_QUEUE_TIMEOUT_US.
+*
+* @param[in]	ticket 	- Ticket
+* @return		status 	- Either Ok or Error on timeout
+*/
+////////////////////////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_queue_wait(const uint32_t ticket)
+{
+	ili9488_status_t 	status 	= eILI9488_OK;
+	const uint32_t		start 	= time_us_32();
+	bool				done 	= ili9488_queue_is_done( ticket );
+
+	while 	(	( false == done )
+			&&	(( time_us_32() - start ) < ILI9488_QUEUE_TIMEOUT_US ))
+	{
+		tight_loop_contents();
+		done = ili9488_queue_is_done( ticket );
+	}
+
+	if ( false == done )
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait until all operations are sent
+*
+*	Waits at most ILI9488_QUEUE_TIMEOUT_US for the queue and as long
+*	again for the last transfer to be shifted out.
+*
+* @return		status 	- Either Ok or Error on timeout
+*/
+////////////////////////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_queue_flush(void)
+{
+	ili9488_status_t 	status 	= ili9488_queue_wait( g_queueHead );
+	const uint32_t		start 	= time_us_32();
+	bool				busy 	= ili9488_if_dma_busy();
+
+	// Last pixels are still shifted out
+	while 	(	( eILI9488_OK == status )
+			&&	( true == busy ))
+	{
+		tight_loop_contents();
+		busy = ili9488_if_dma_busy();
+
+		if 	(	( true == busy )
+			&&	(( time_us_32() - start ) >= ILI9488_QUEUE_TIMEOUT_US ))
+		{
+			status = eILI9488_ERROR;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Begin transaction
+*
+*	Operations pushed until ili9488_queue_end() are not started while
+*	the queue is idle, they are sent together as one chain.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void ili9488_queue_begin(void)
+{
+	g_queueHold++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		End transaction and start it if idle
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void ili9488_queue_end(void)
+{
+	g_queueHold--;
+
+	if ( 0U == g_queueHold )
+	{
+		ili9488_if_lock();
+
+		if ( false == g_queueInFlight )
+		{
+			ili9488_queue_run();
+		}
+
+		ili9488_if_unlock();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Transfer finished
+*
+* @note	Called from DMA interrupt, ignores transfers not started by the queue.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void ili9488_queue_transfer_done(void)
+{
+	if ( true == g_queueInFlight )
+	{
+		g_queueInFlight = false;
+
+		for ( ; g_chainOps > 0U; g_chainOps-- )
+		{
+			ili9488_queue_release();
+		}
+
+		ili9488_queue_run();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reserve next free operation
+*
+*	Waits at most ILI9488_QUEUE_TIMEOUT_US for a free operation.
+*
+* @return		p_op - Operation to fill in, NULL on timeout
+*/
+////////////////////////////////////////////////////////////////////////////////
+static ili9488_queue_op_t * ili9488_queue_reserve(void)
+{
+	ili9488_queue_op_t *	p_op 	= NULL;
+	const uint32_t			start 	= time_us_32();
+	bool					full 	= (( g_queueHead - g_queueTail ) >= ILI9488_QUEUE_LENGTH );
+
+	// Wait for a free operation
+	while 	(	( true == full )
+			&&	(( time_us_32() - start ) < ILI9488_QUEUE_TIMEOUT_US ))
+	{
+		tight_loop_contents();
+		full = (( g_queueHead - g_queueTail ) >= ILI9488_QUEUE_LENGTH );
+	}
+
+	if ( false == full )
+	{
+		p_op = &g_queueOps[ g_queueHead & ( ILI9488_QUEUE_LENGTH - 1U )];
+		p_op->arena = false;
+	}
+
+	return p_op;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Commit reserved operation and start it if idle
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void ili9488_queue_commit(void)
+{
+	// Operation is complete before it is seen by the interrupt
+	__dmb();
+
+	ili9488_if_lock();
+
+	g_queueHead++;
+
+	if 	(	( false == g_queueInFlight )
+		&&	( 0U == g_queueHold ))
+	{
+		ili9488_queue_run();
+	}
+
+	ili9488_if_unlock();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release oldest operation
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void ili9488_queue_release(void)
+{
+	const ili9488_queue_op_t * p_op = &g_queueOps[ g_queueTail & ( ILI9488_QUEUE_LENGTH - 1U )];
+
+	if ( true == p_op->arena )
+	{
+		g_arenaTail = p_op->arena_end;
+	}
+
+	g_queueTail++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Send queued operations
+*
+*	Starts them as chain, its DMA interrupt continues.
+*
+* @note	Called with the DMA interrupt locked or from it.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void ili9488_queue_run(void)
+{
+	if 	(	( g_queueTail != g_queueHead )
+		&&	( false == g_queueInFlight ))
+	{
+		ili9488_queue_start_chain();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start chain of queued operations
+*
+*	Takes commands up to and including the first fill or pixel buffer,
+*	as long as they fit into one chain. Parameters longer than a segment
+*	are split into several, each is waited for like a DC change.
+*
+* @note	Called with the DMA interrupt locked or from it.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void ili9488_queue_start_chain(void)
+{
+	ili9488_queue_op_t * 	p_op;
+	uint32_t				op_idx 		= g_queueTail;
+	uint32_t				segments 	= 0U;
+	uint32_t				words 		= 0U;
+	uint32_t				i;
+	uint32_t				size;
+	bool					full 		= false;
+	bool					payload 	= false;
+
+	g_chainOps = 0U;
+
+	while 	(	( op_idx != g_queueHead )
+			&&	( false == full )
+			&&	( false == payload ))
+	{
+		p_op = &g_queueOps[ op_idx & ( ILI9488_QUEUE_LENGTH - 1U )];
+
+		if ( eILI9488_QUEUE_OP_CMD == p_op->type )
+		{
+			full = (( segments + ILI9488_QUEUE_CMD_SEGMENTS( p_op->count )) > ILI9488_IF_CHAIN_SEGMENTS );
+
+			if ( false == full )
+			{
+				g_chainWords[ words ] = p_op->value;
+				g_chainSegments[ segments ].p_data 		= &g_chainWords[ words ];
+				g_chainSegments[ segments ].size 		= 1U;
+				g_chainSegments[ segments ].dc 			= false;
+				g_chainSegments[ segments ].increment 	= true;
+				segments++;
+				words++;
+
+				// Parameters are sent as zero-extended words
+				for ( i = 0; i < p_op->count; i++ )
+				{
+					g_chainWords[ words + i ] = p_op->params[i];
+				}
+
+				for ( i = 0; i < p_op->count; i += size )
+				{
+					size = MIN( p_op->count - i, ILI9488_IF_CHAIN_SEGMENT_MAX );
+
+					g_chainSegments[ segments ].p_data 		= &g_chainWords[ words + i ];
+					g_chainSegments[ segments ].size 		= size;
+					g_chainSegments[ segments ].dc 			= true;
+					g_chainSegments[ segments ].increment 	= true;
+					segments++;
+				}
+
+				words += p_op->count;
+			}
+		}
+		else
+		{
+			full = ( segments >= ILI9488_IF_CHAIN_SEGMENTS );
+
+			if ( false == full )
+			{
+				if ( eILI9488_QUEUE_OP_FILL == p_op->type )
+				{
+					g_chainSegments[ segments ].p_data 		= &p_op->value;
+					g_chainSegments[ segments ].increment 	= false;
+				}
+				else
+				{
+					g_chainSegments[ segments ].p_data 		= p_op->p_pixels;
+					g_chainSegments[ segments ].increment 	= true;
+				}
+
+				g_chainSegments[ segments ].size 	= p_op->count;
+				g_chainSegments[ segments ].dc 		= true;
+				segments++;
+				payload = true;
+			}
+		}
+
+		if ( false == full )
+		{
+			g_chainOps++;
+			op_idx++;
+		}
+	}
+
+	g_queueInFlight = true;
+	ili9488_if_spi_transmit_chain( g_chainSegments, segments );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
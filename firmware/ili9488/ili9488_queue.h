@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      ili9488_queue.h
+*@brief     Queue of display transfers drained by the DMA interrupt
+*@author    Leon Farchau
+*@date      17.10.2026
+*@version	V1.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup ILI9488_QUEUE
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Queue of display transfers drained by the DMA interrupt
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _ILI9488_QUEUE_H_
+#define _ILI9488_QUEUE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdbool.h>
+#include <stdint.h>
+#include "ili9488_cfg.h"
+#include "ili9488_regdef.h"
+#include "ili9488_types.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// Longest parameter list of a queued command, ili9488_low_if sends longer ones blocking
+#define ILI9488_QUEUE_MAX_PARAMS		( 16U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+ili9488_status_t	ili9488_queue_push_command		(const ili9488_cmd_t cmd, const uint8_t * const p_params, const uint32_t size);
+ili9488_status_t	ili9488_queue_push_fill			(const uint16_t color, const uint32_t count);
+ili9488_status_t	ili9488_queue_push_pixels		(const uint16_t * const p_pixels, const uint32_t count);
+uint16_t *			ili9488_queue_alloc				(const uint32_t count);
+
+uint32_t			ili9488_queue_get_ticket		(void);
+bool				ili9488_queue_is_done			(const uint32_t ticket);
+ili9488_status_t	ili9488_queue_wait				(const uint32_t ticket);
+ili9488_status_t	ili9488_queue_flush				(void);
+void				ili9488_queue_begin				(void);
+void				ili9488_queue_end				(void);
+
+void				ili9488_queue_transfer_done		(void);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifdef __cplusplus
+}
+#endif // extern "C"
+#endif // _ILI9488_QUEUE_H_
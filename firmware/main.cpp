@@ -19,6 +19,9 @@
 #include "core1main.h"
 #include "DAC.h"
 #include "ToneSheduler.h"
+#include "CoreBus.h"
+#include "SongSequencer.h"
+#include "ui_songs/songs/ui_song_interface.h"
 
 // Defines
 extern const uint DEBUG1_PIN = 19;
@@ -27,7 +30,6 @@ extern const uint DEBUG3_PIN = 21;
 extern const uint DEBUG4_PIN = 22;
 
 #define USE_DEBUG_PINS 0
-#define FLAG_VALUE 123
 
 const uint AUDIO_LRCLK = 28;
 const uint AUDIO_BCLK = 27;
@@ -46,60 +48,119 @@ interp_config cfg;
 // private function prototypes
 bool alarm_callback(struct repeating_timer *timer);
 void setup();
+void handleCommand(const BusCommand& command);
+
+static SongSequencer *sequencer;
+static int songStatus = 0; // result of the last load, reported in the telemetry
 
 
 int main()
 {
     setup();
 
-    ToneSheduler toneSheduler;
+    // static, the scheduler holds the mix and DMA buffers and is too big for the stack
+    static ToneSheduler<> toneSheduler;
+    static SongSequencer songSequencer(toneSheduler);
+    sequencer = &songSequencer;
+    songStatus = songSequencer.load(CSongGetTones(), *CSongGetEnvelopes(), *CSongGetChannelPans());
 
-    //start core 1
+    //start core 1, from then on the cores only talk through the bus
+    CoreBus &bus = CoreBus::getInstance();
     multicore_launch_core1(core1_entry);
-    uint32_t g = multicore_fifo_pop_blocking(); //wait for core 1 to be ready
-    multicore_fifo_push_blocking(FLAG_VALUE); //tell core 1 that core 0 is ready
-
-    AdsrProfile defaultProfile = AdsrProfile(0.1, 0.1, 0.2, 0.3);
-
-    float duration = 0.3;
-
-    //frequency creation
-    float pitches[] = {67.0,55.0,43.0,67.0,55.0,43.0,67.0,55.0,43.0,63.0,51.0,39.0,65.0,53.0,41.0,65.0,53.0,41.0,65.0,53.0,41.0,62.0,50.0,38.0};
-    const uint32_t PITCH_NUMBER = sizeof(pitches)/sizeof(pitches[0]);
-    float times[PITCH_NUMBER] = {0.25,0.25,0.25,0.5,0.5,0.5,0.75,0.75,0.75,1.0,1.0,1.0,2.25,2.25,2.25,2.5,2.5,2.5,2.75,2.75,2.75,3.0,3.0,3.0};
-    float durations[PITCH_NUMBER] = {0.23,0.23,0.23,0.23,0.23,0.23,0.23,0.23,0.23,0.97,0.97,0.97,0.23,0.23,0.23,0.23,0.23,0.23,0.23,0.23,0.23,1.97,1.97,1.97};
-    uint32_t frequencies[PITCH_NUMBER];
+    bus.enableDoorbell();
 
+    uint32_t lastTelemetryTime = 0;
 
     while (1)
     {
-        if(!toneSheduler.busy())
+        BusCommand command;
+        while (bus.receiveCommand(&command))
+        {
+            handleCommand(command);
+        }
+
+        //toggle debug2 pin
+        gpio_xor_mask(USE_DEBUG_PINS << DEBUG2_PIN);
+        songSequencer.update();
+        //toggle debug2 pin
+        gpio_xor_mask(USE_DEBUG_PINS << DEBUG2_PIN);
+
+        // rewind once the last note has faded out
+        if (songSequencer.isPlaying() && songSequencer.isFinished() && !toneSheduler.busy())
         {
-            //toggle debug2 pin
-            gpio_xor_mask(USE_DEBUG_PINS << DEBUG2_PIN);
-            for (int i = 0; i < PITCH_NUMBER; i+=1)
-            {
-                frequencies[i] = powf( 2, (pitches[i] - 69) / 12) * 440;
-
-                toneSheduler.addToneRel(frequencies[i], times[i], duration, defaultProfile);
-            }
-            //toggle debug2 pin
-            gpio_xor_mask(USE_DEBUG_PINS << DEBUG2_PIN);
+            songSequencer.stop();
         }
 
         toneSheduler.cyclicHandler();
+
+        // one snapshot per rendered block
+        if (toneSheduler.getSampleTime() != lastTelemetryTime)
+        {
+            lastTelemetryTime = toneSheduler.getSampleTime();
+            bus.postTelemetry({
+                .sampleTime = lastTelemetryTime,
+                .underruns = dac->getStats().underruns,
+                .peakLeft = toneSheduler.getPeakLeft(),
+                .peakRight = toneSheduler.getPeakRight(),
+                .songOrigin = songSequencer.getOrigin(),
+                .voices = toneSheduler.getActiveVoices(),
+                .songPlaying = songSequencer.isPlaying(),
+                .songStatus = (int8_t)songStatus
+            });
+        }
+
+        // sleep until the DMA frees a buffer or the UI rings the doorbell, with the
+        // interrupts masked a wakeup between the check and __wfi stays pending
+        uint32_t interruptStatus = save_and_disable_interrupts();
+        if (dac->getFreeBuffers() == 0 && !bus.commandPending())
+        {
+            __wfi();
+        }
+        restore_interrupts(interruptStatus);
     }
     
     return 0;
 }
 
+//***************************************************************************************
+//* Carries out a command of the UI
+//***************************************************************************************
+void handleCommand(const BusCommand& command)
+{
+    switch (command.type)
+    {
+    case CMD_PLAY:
+        sequencer->play();
+        break;
+    case CMD_PAUSE:
+        sequencer->pause();
+        break;
+    case CMD_STOP:
+        sequencer->stop();
+        break;
+    case CMD_SEEK:
+        sequencer->seek(command.value);
+        break;
+    case CMD_VOLUME:
+        // clamped before it is narrowed to 8 bit, 256 % would wrap to silence
+        MasterVolume::getInstance().setVolume(MIN(command.value, 100u));
+        break;
+    case CMD_LOAD_SONG:
+        // only one song is compiled in, loading rewinds it
+        songStatus = sequencer->load(CSongGetTones(), *CSongGetEnvelopes(), *CSongGetChannelPans());
+        break;
+    default:
+        break;
+    }
+}
+
 void setup()
 {
     stdio_init_all();
 
     // ** I²S initialisation **
     dac = &DAC::getInstance();
-    dac->setup(AUDIO_LRCLK, AUDIO_BCLK, AUDIO_DOUT, SAMPLE_RATE);
+    dac->setup(AUDIO_LRCLK, AUDIO_BCLK, AUDIO_DOUT, SYNTH_SAMPLE_RATE, SYNTH_OUTPUT_FORMAT);
 
     // ** GPIO initialisation **
     // We will make this GPIO an input, and pull it up by default
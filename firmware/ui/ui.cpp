@@ -32,6 +32,8 @@
 #include "../ui_songs/ui_song.h"
 
 #include "../ui_songs/songs/ui_song_interface.h"
+#include "../CoreBus.h"
+#include "../TransportClock.h"
 
 ////////////////////////////////////////
 // Defines
@@ -72,10 +74,12 @@ void ui_drawTones(std::span<ui_tone> tones);
 void ui_drawSongMetadata(ui_song &song);
 
 void ui_updateSong(std::string name );
-void ui_updateTime(uint32_t deltaTime);
+void ui_updateTime();
 void ui_updateVisibleTones();
 
 void ui_timeToString(uint32_t time, std::string* str);
+void ui_sendCommand(BusCommandType type, uint32_t value = 0);
+void ui_receiveTelemetry();
 
 ////////////////////////////////////////
 // Variables
@@ -101,6 +105,9 @@ std::span<Rectangle*> g_volumeBars;
 
 uint8_t g_volume = 50;
 bool g_isPlaying = false;
+bool g_playSeen = false;    // the engine reported playing since the play button was pressed
+
+BusTelemetry g_telemetry = {};
 
 ui_song g_song; 
 std::span<ui_tone> g_visibleTones;
@@ -132,6 +139,8 @@ void ui_setup() {
  * 
  */
 void ui_loop() {
+    ui_receiveTelemetry();
+
     uint32_t now = time_us_32();
     if( g_nextTime_touch <= now ) {
         ui_updateTouch();
@@ -144,7 +153,7 @@ void ui_loop() {
     if( g_nextTime_tones <= now ) {
         if(g_isPlaying)
         {
-            ui_updateTime(TONES_PERIOD);
+            ui_updateTime();
             ui_updateVisibleTones();
             ui_drawTones(g_visibleTones);
         }
@@ -160,14 +169,65 @@ void ui_loop() {
     }
 }
 
+/**
+ * @brief Sends a command to the audio engine on core 0
+ * 
+ * @param type      Type of the command
+ * @param value     Argument of the command, see BusCommandType
+ */
+void ui_sendCommand(BusCommandType type, uint32_t value)
+{
+    BusCommand command = {type, value};
+    CoreBus::getInstance().postCommand(command);
+}
+
+/**
+ * @brief Takes the telemetry of the audio engine from the bus, only the latest is kept
+ * 
+ * Called every loop, telemetry rings no doorbell. Shows the player as stopped once the
+ * song has ended.
+ * 
+ */
+void ui_receiveTelemetry()
+{
+    while(CoreBus::getInstance().receiveTelemetry(&g_telemetry)) {
+    }
+
+    // the engine stops and rewinds at the end of the song. Until the play command has
+    // reached it, the telemetry still says stopped, so only a stop after playing counts.
+    if(g_isPlaying) {
+        if(g_telemetry.songPlaying) {
+            g_playSeen = true;
+        }
+        else if(g_playSeen) {
+            g_isPlaying = false;
+            g_song.setProgress(0);
+            ui_drawTones(std::span<ui_tone>{});
+            g_playBtn->deactivate();
+        }
+    }
+}
+
 /**
  * @brief Updates the internal time of the song that is used for displaying
  * 
- * @param time 
+ * The progress is the audible sample of the audio engine minus the sample at which the
+ * sequencer started the song, so the display stays locked to what is heard no matter
+ * when this task runs. It holds until the play command reached the sequencer and after
+ * the song ended.
  */
-void ui_updateTime(uint32_t deltaTime)
+void ui_updateTime()
 {
-    g_song.updateProgress(deltaTime);
+    const TransportClock &clock = TransportClock::getInstance();
+    const uint32_t sampleRate = clock.getSampleRate();
+    if(sampleRate == 0 || !g_telemetry.songPlaying) {
+        return;
+    }
+
+    // the sequencer counts in the 32 bit samples of the engine
+    const int32_t samples = (int32_t)((uint32_t)clock.getSamplesAt(time_us_64()) - g_telemetry.songOrigin);
+    const uint32_t progress = samples < 0 ? 0 : (uint64_t)samples * 1'000'000 / sampleRate;
+    g_song.setProgress(MIN(progress, g_song.getDuration()));
 }
 
 /**
@@ -334,18 +394,22 @@ void ui_buildMenu()
     // set touch callbacks
 
     g_pauseBtn->setOnPress([](Button* btn){
+        ui_sendCommand(CMD_PAUSE);
         g_isPlaying = false;
         btn->activate();
         g_playBtn->deactivate();
     });
 
     g_playBtn->setOnPress([](Button* btn){
+        ui_sendCommand(CMD_PLAY);
         g_isPlaying = true;
+        g_playSeen = false;
         g_pauseBtn->deactivate();
         btn->activate();
     });
 
     g_stopBtn->setOnPress([](Button* btn){
+        ui_sendCommand(CMD_STOP);
         g_isPlaying = false;
         g_song.setProgress(0);
         ui_drawTones(std::span<ui_tone>{});
@@ -420,10 +484,14 @@ void ui_buildVolumeCtrl( const Point size, const Point pos, const uint16_t btnLe
     g_volumeGrayBar = new Rectangle(sliderBgPos, sliderBgSize, sliderBgColor);
     g_volumeGrayBar->draw();
 
+    // the audio engine on core 0 starts with the volume of the slider
+    ui_sendCommand(CMD_VOLUME, g_volume);
+
     // set touch callbacks
     louderBtn->setOnPress([](Button* btn){
         if(g_volume <= 95) {
             g_volume += 5;
+            ui_sendCommand(CMD_VOLUME, g_volume);
             ui_updateVolumeSlider();
         }
     });
@@ -431,6 +499,7 @@ void ui_buildVolumeCtrl( const Point size, const Point pos, const uint16_t btnLe
     quiterBtn->setOnPress([](Button* btn){
         if(g_volume >= 5) {
             g_volume -= 5;
+            ui_sendCommand(CMD_VOLUME, g_volume);
             ui_updateVolumeSlider();
         }
     });
@@ -502,7 +571,7 @@ void ui_drawTones(std::span<ui_tone> tones)
         }
 
         Point noteSize(size.x * noteDuration / timeFrameShown, 4);
-        Point offset(size.x * MAX(relStartTime, 0) / timeFrameShown, size.y * tone.frequency / 128 - noteSize.y / 2);
+        Point offset(size.x * MAX(relStartTime, 0) / timeFrameShown, size.y * tone.note / 128 - noteSize.y / 2);
 
         noteSize.x = MIN(noteSize.x, size.x - offset.x);
         noteSize.x = MAX(noteSize.x, 1);
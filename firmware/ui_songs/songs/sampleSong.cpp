@@ -9,1039 +9,1040 @@ static const uint16_t songBpm = 384;
 static const uint32_t songDuration = 146'000'000;
 
 static std::vector<ui_tone> songTones =
-{//  note       duration        start  channelIdx     velocity     adsr
-    { 76,        345871,       3464780,           3,        95, nullptr},
-    { 75,        364075,       3783346,           3,        91, nullptr},
-    { 76,        354973,       4071572,           3,        94, nullptr},
-    { 75,        342837,       4350696,           3,       102, nullptr},
-    { 76,        342837,       4635888,           3,       102, nullptr},
-    { 71,        306429,       4936250,           3,        97, nullptr},
-    { 74,        330701,       5224476,           3,        93, nullptr},
-    { 72,        306429,       5518770,           3,        90, nullptr},
-    { 33,       1680812,       5825200,           1,       115, nullptr},
-    { 45,        761523,       5837335,           3,        90, nullptr},
-    { 52,        621961,       6146799,           3,        74, nullptr},
-    { 57,        251818,       6428957,           3,        76, nullptr},
-    { 60,        361041,       6702013,           3,        94, nullptr},
-    { 64,        339803,       6978104,           3,       102, nullptr},
-    { 69,         81916,       7232956,           3,       110, nullptr},
-    { 28,       1542786,       7539386,           1,       119, nullptr},
-    { 40,        283702,       7548488,           3,        79, nullptr},
-    { 74,       1494758,       7569726,           4,       102, nullptr},
-    { 52,        321339,       7843982,           3,        82, nullptr},
-    { 56,        168040,       8126997,           3,        89, nullptr},
-    { 64,        392093,       8410012,           3,       100, nullptr},
-    { 68,        336080,       8675339,           3,       106, nullptr},
-    { 71,        120870,       8943613,           3,       110, nullptr},
-    { 33,       1650397,       9238421,           1,       116, nullptr},
-    { 72,        680536,       9264953,           4,       102, nullptr},
-    { 69,       3136666,       9267901,           4,       102, nullptr},
-    { 45,        689242,       9276691,           3,        72, nullptr},
-    { 52,        432237,       9559981,           3,        75, nullptr},
-    { 57,        163549,       9866636,           3,        74, nullptr},
-    { 64,        306654,      10182052,           3,        84, nullptr},
-    { 76,        324177,      10450740,           3,        96, nullptr},
-    { 75,        350462,      10701905,           3,        90, nullptr},
-    { 51,         11682,      10766156,           9,        36, nullptr},
-    { 51,         11682,      10859613,           9,        41, nullptr},
-    { 51,         11682,      10944308,           9,        67, nullptr},
-    { 53,         11682,      10950149,           9,        27, nullptr},
-    { 76,        335859,      10988116,           3,        90, nullptr},
-    { 75,        327098,      11250963,           3,       102, nullptr},
-    { 76,        338780,      11522571,           3,       110, nullptr},
-    { 71,        373826,      11779577,           3,       108, nullptr},
-    { 74,        327098,      12068708,           3,        92, nullptr},
-    { 72,         46728,      12357840,           3,        76, nullptr},
-    { 76,       1483126,      12632369,           4,       102, nullptr},
-    { 33,       1555326,      12635290,           1,       115, nullptr},
-    { 69,        391349,      12673256,           3,        77, nullptr},
-    { 45,        641224,      12717064,           3,        56, nullptr},
-    { 52,        429795,      12991593,           3,        70, nullptr},
-    { 57,        186297,      13232087,           3,        79, nullptr},
-    { 60,        348555,      13502518,           3,        98, nullptr},
-    { 64,        345551,      13775954,           3,       108, nullptr},
-    { 69,        252402,      14031362,           3,       112, nullptr},
-    { 28,       1652163,      14325831,           1,       118, nullptr},
-    { 68,       1799879,      14346865,           4,       102, nullptr},
-    { 40,        275000,      14377995,           3,        78, nullptr},
-    { 52,        315625,      14674870,           3,        82, nullptr},
-    { 56,        178124,      14981120,           3,        80, nullptr},
-    { 64,        343750,      15287370,           3,        87, nullptr},
-    { 72,        334375,      15581120,           3,        96, nullptr},
-    { 71,        115624,      15852995,           3,        96, nullptr},
-    { 72,       3098316,      16146745,           4,       102, nullptr},
-    { 64,       3044597,      16149870,           4,       102, nullptr},
-    { 69,        669632,      16182607,           3,        92, nullptr},
-    { 45,        544634,      16203440,           3,        66, nullptr},
-    { 52,        398803,      16471293,           3,        75, nullptr},
-    { 57,        139878,      16768908,           3,        67, nullptr},
-    { 76,        288686,      17349256,           3,        86, nullptr},
-    { 75,        276781,      17640919,           3,        94, nullptr},
-    { 76,        288686,      17911748,           3,       114, nullptr},
-    { 75,        297614,      18167696,           3,       110, nullptr},
-    { 76,        267853,      18456383,           3,       108, nullptr},
-    { 71,        282733,      18709355,           3,       114, nullptr},
-    { 74,        321423,      19009946,           3,       100, nullptr},
-    { 33,       1731249,      19578389,           1,       115, nullptr},
-    { 69,        399999,      19587764,           3,        80, nullptr},
-    { 45,        625000,      19600264,           3,        73, nullptr},
-    { 42,         12499,      19878389,           9,        45, nullptr},
-    { 52,        365625,      19906514,           3,        56, nullptr},
-    { 42,         12499,      20178389,           9,        43, nullptr},
-    { 57,        162500,      20194014,           3,        80, nullptr},
-    { 81,         12499,      20478389,           9,        34, nullptr},
-    { 60,        337500,      20487764,           3,        87, nullptr},
-    { 42,         12500,      20778389,           9,        45, nullptr},
-    { 64,        315624,      20784639,           3,        90, nullptr},
-    { 69,         87499,      21065889,           3,       100, nullptr},
-    { 35,         12499,      21078389,           9,        81, nullptr},
-    { 28,       1634375,      21344014,           1,       116, nullptr},
-    { 74,       1565625,      21375264,           4,       102, nullptr},
-    { 35,         12500,      21378389,           9,       103, nullptr},
-    { 40,        268750,      21384639,           3,        74, nullptr},
-    { 52,        296875,      21675264,           3,        84, nullptr},
-    { 42,         12499,      21678389,           9,        45, nullptr},
-    { 56,        153125,      21965889,           3,        96, nullptr},
-    { 42,         12499,      21978389,           9,        43, nullptr},
-    { 64,        393749,      22250264,           3,       108, nullptr},
-    { 81,         12499,      22278389,           9,        34, nullptr},
-    { 68,        346875,      22537764,           3,       110, nullptr},
-    { 42,         12499,      22578389,           9,        45, nullptr},
-    { 71,        118750,      22822139,           3,       110, nullptr},
-    { 35,         12500,      22878389,           9,        79, nullptr},
-    { 33,       1799065,      23144014,           1,       116, nullptr},
-    { 72,        542397,      23172139,           4,       102, nullptr},
-    { 69,       1819897,      23175264,           4,       102, nullptr},
-    { 46,         12254,      23178389,           9,        45, nullptr},
-    { 45,        603548,      23181453,           3,        58, nullptr},
-    { 52,        389089,      23484759,           3,        70, nullptr},
-    { 57,        125611,      23809511,           3,        72, nullptr},
-    { 64,        287987,      24100563,           3,        86, nullptr},
-    { 76,        333943,      24379359,           3,        96, nullptr},
-    { 75,        355388,      24664283,           3,        86, nullptr},
-    { 76,        349261,      24952271,           3,        84, nullptr},
-    { 75,        321688,      25243322,           3,        84, nullptr},
-    { 76,        404408,      25525182,           3,        92, nullptr},
-    { 71,        367643,      25816233,           3,        96, nullptr},
-    { 74,        337006,      26107285,           3,        90, nullptr},
-    { 72,         24509,      26404463,           3,        82, nullptr},
-    { 72,         55146,      26704706,           4,       102, nullptr},
-    { 33,       1602314,      26707770,           1,       115, nullptr},
-    { 69,        346197,      26723088,           3,        82, nullptr},
-    { 45,        530019,      26747598,           3,        59, nullptr},
-    { 42,         12254,      27001885,           9,        45, nullptr},
-    { 52,        309433,      27050904,           3,        54, nullptr},
-    { 42,         12254,      27296000,           9,        43, nullptr},
-    { 57,        143993,      27317445,           3,        83, nullptr},
-    { 37,         12254,      27590115,           9,        82, nullptr},
-    { 60,        306369,      27602369,           3,        94, nullptr},
-    { 64,        346197,      27884230,           3,       100, nullptr},
-    { 69,         61273,      28166090,           3,       114, nullptr},
-    { 35,         12254,      28178345,           9,        81, nullptr},
-    { 28,       1620696,      28447950,           1,       118, nullptr},
-    { 68,       1639078,      28469396,           4,       102, nullptr},
-    { 42,         12254,      28472459,           9,        53, nullptr},
-    { 40,        266541,      28478587,           3,        75, nullptr},
-    { 42,         12254,      28766574,           9,        45, nullptr},
-    { 52,        291051,      28772702,           3,        84, nullptr},
-    { 42,         12254,      29060689,           9,        43, nullptr},
-    { 56,        134802,      29063753,           3,        84, nullptr},
-    { 42,         12254,      29354804,           9,        44, nullptr},
-    { 64,        379898,      29357868,           3,       104, nullptr},
-    { 42,         12254,      29648919,           9,        45, nullptr},
-    { 72,        346197,      29651983,           3,       110, nullptr},
-    { 71,        110293,      29936907,           3,       108, nullptr},
-    { 42,         12254,      29943034,           9,        43, nullptr},
-    { 60,        951754,      30154430,           2,        87, nullptr},
-    { 72,        800583,      30237149,           4,       102, nullptr},
-    { 69,        380946,      30243102,           3,        92, nullptr},
-    { 45,        571419,      30249054,           3,        73, nullptr},
-    { 42,         11904,      30522859,           9,        45, nullptr},
-    { 52,        333328,      30537740,           3,        80, nullptr},
-    { 42,         11904,      30808569,           9,        43, nullptr},
-    { 57,        172616,      30832379,           3,        84, nullptr},
-    { 55,        877963,      31094279,           2,        69, nullptr},
-    { 67,        654752,      31097256,           4,       102, nullptr},
-    { 62,        639871,      31100232,           2,        86, nullptr},
-    { 81,         11904,      31109160,           9,        25, nullptr},
-    { 71,        363089,      31112136,           3,       112, nullptr},
-    { 42,         11904,      31379989,           9,        45, nullptr},
-    { 81,         11904,      31385942,           9,        28, nullptr},
-    { 72,        354161,      31394870,           3,       114, nullptr},
-    { 81,         11904,      31662723,           9,        35, nullptr},
-    { 42,         11904,      31665699,           9,        43, nullptr},
-    { 74,        363089,      31668676,           3,       125, nullptr},
-    { 36,       1485096,      31945457,           1,       124, nullptr},
-    { 72,       1401764,      31948433,           4,       102, nullptr},
-    { 35,         11904,      31951409,           9,       103, nullptr},
-    { 76,        407731,      31963314,           3,       106, nullptr},
-    { 48,        526777,      31990099,           3,        79, nullptr},
-    { 42,         11904,      32237119,           9,        45, nullptr},
-    { 55,        374994,      32252000,           3,        90, nullptr},
-    { 42,         11904,      32522829,           9,        43, nullptr},
-    { 60,        154759,      32531758,           3,        87, nullptr},
-    { 37,         11904,      32808539,           9,        82, nullptr},
-    { 67,        386898,      32820444,           3,       110, nullptr},
-    { 42,         11904,      33094249,           9,        45, nullptr},
-    { 77,        372018,      33103178,           3,       123, nullptr},
-    { 76,        374994,      33374007,           3,       116, nullptr},
-    { 35,         11904,      33379959,           9,        79, nullptr},
-    { 62,       1458311,      33662693,           4,       102, nullptr},
-    { 35,         11904,      33665670,           9,       103, nullptr},
-    { 31,        702370,      33668646,           1,       120, nullptr},
-    { 71,       1267838,      33671622,           2,        86, nullptr},
-    { 43,        249996,      33680550,           3,        84, nullptr},
-    { 74,        366065,      33701383,           2,        76, nullptr},
-    { 42,         11904,      33951380,           9,        45, nullptr},
-    { 55,        294638,      33957332,           3,        92, nullptr},
-    { 42,         11904,      34237090,           9,        43, nullptr},
-    { 59,        178568,      34240066,           3,        98, nullptr},
-    { 56,        877963,      34493038,           2,        85, nullptr},
-    { 68,        571420,      34522800,           4,       102, nullptr},
-    { 32,        705346,      34525776,           1,       123, nullptr},
-    { 42,         11904,      34808510,           9,        45, nullptr},
-    { 76,        357137,      34811486,           3,       120, nullptr},
-    { 74,        333328,      35085291,           3,       108, nullptr},
-    { 35,         11904,      35094220,           9,        81, nullptr},
-    { 69,       1309504,      35376953,           4,       102, nullptr},
-    { 42,         11904,      35379930,           9,        53, nullptr},
-    { 72,        485111,      35382906,           3,       102, nullptr},
-    { 33,       1178553,      35388858,           1,       120, nullptr},
-    { 45,        595229,      35400763,           3,        74, nullptr},
-    { 42,         11904,      35665640,           9,        45, nullptr},
-    { 52,        410708,      35677544,           3,        78, nullptr},
-    { 42,         11904,      35951350,           9,        43, nullptr},
-    { 57,        151783,      35972183,           3,        78, nullptr},
-    { 42,         11904,      36237060,           9,        44, nullptr},
-    { 64,        380946,      36257893,           3,        84, nullptr},
-    { 42,         11904,      36522770,           9,        45, nullptr},
-    { 74,        333328,      36561459,           3,        90, nullptr},
-    { 42,         11904,      36808480,           9,        43, nullptr},
-    { 33,        285710,      36820384,           1,       123, nullptr},
-    { 72,        154759,      36826336,           3,        94, nullptr},
-    { 68,       1705331,      37094190,           4,       102, nullptr},
-    { 28,       3463547,      37103118,           1,       121, nullptr},
-    { 71,        416660,      37135856,           3,        98, nullptr},
-    { 40,        241067,      37150736,           3,        80, nullptr},
-    { 52,         53570,      37427518,           3,        83, nullptr},
-    { 64,         50594,      37710252,           3,        83, nullptr},
-    { 64,        247020,      37972153,           3,       102, nullptr},
-    { 76,        116069,      38257863,           3,       114, nullptr},
-    { 64,        226187,      38537620,           3,        92, nullptr},
-    { 76,         89284,      38823330,           3,        89, nullptr},
-    { 76,        285710,      39100112,           3,       116, nullptr},
-    { 88,         80355,      39409631,           3,       102, nullptr},
-    { 75,        276090,      39680749,           3,        82, nullptr},
-    { 76,        133494,      39962907,           3,        92, nullptr},
-    { 75,        324633,      40251133,           3,        92, nullptr},
-    { 76,        339803,      40542393,           2,        76, nullptr},
-    { 75,        330701,      40821518,           2,        84, nullptr},
-    { 76,        309463,      41106710,           3,       106, nullptr},
-    { 71,        294293,      41394936,           3,       110, nullptr},
-    { 74,        339803,      41695298,           3,       102, nullptr},
-    { 33,       1680812,      42286920,           1,       115, nullptr},
-    { 69,        348905,      42314225,           3,        85, nullptr},
-    { 45,        716014,      42347599,           3,        66, nullptr},
-    { 42,         12135,      42578180,           9,        45, nullptr},
-    { 52,        452059,      42617621,           3,        70, nullptr},
-    { 42,         12135,      42869440,           9,        43, nullptr},
-    { 57,        182037,      42908881,           3,        75, nullptr},
-    { 81,         12135,      43160700,           9,        34, nullptr},
-    { 60,        364074,      43191039,           3,        94, nullptr},
-    { 42,         12135,      43451960,           9,        45, nullptr},
-    { 64,        330701,      43476231,           3,       100, nullptr},
-    { 69,         97086,      43740186,           3,       106, nullptr},
-    { 42,         12135,      43743220,           9,        43, nullptr},
-    { 28,       1586760,      44001106,           1,       116, nullptr},
-    { 74,       1435062,      44034480,           4,       102, nullptr},
-    { 40,        294293,      44040547,           3,        82, nullptr},
-    { 42,         12135,      44325740,           9,        45, nullptr},
-    { 52,        321599,      44331807,           3,        86, nullptr},
-    { 42,         12135,      44617000,           9,        43, nullptr},
-    { 56,        133494,      44620033,           3,        96, nullptr},
-    { 64,        382278,      44893090,           3,       108, nullptr},
-    { 42,         12135,      44908260,           9,        44, nullptr},
-    { 68,        324633,      45175248,           3,       106, nullptr},
-    { 42,         12135,      45199520,           9,        45, nullptr},
-    { 71,          9101,      45451338,           3,       110, nullptr},
-    { 35,         12135,      45490780,           9,        79, nullptr},
-    { 33,       1731463,      45748666,           1,       116, nullptr},
-    { 69,       1300186,      45779006,           4,       102, nullptr},
-    { 45,        790083,      45782040,           3,        74, nullptr},
-    { 52,        586666,      46056210,           3,        83, nullptr},
-    { 57,        283015,      46342173,           3,        74, nullptr},
-    { 64,        406834,      46625188,           3,        85, nullptr},
-    { 76,        336080,      46928840,           3,        98, nullptr},
-    { 75,        353768,      47194166,           3,        90, nullptr},
-    { 76,        327236,      47483078,           3,        94, nullptr},
-    { 75,        336080,      47751352,           3,       108, nullptr},
-    { 76,        344924,      48031419,           3,       106, nullptr},
-    { 71,        359664,      48305590,           3,       104, nullptr},
-    { 74,        321339,      48591553,           3,        96, nullptr},
-    { 72,         32428,      48856880,           3,        84, nullptr},
-    { 45,       1155644,      49160531,           3,        82, nullptr},
-    { 69,        849044,      49175271,           4,       102, nullptr},
-    { 33,       1541842,      49178220,           1,       115, nullptr},
-    { 52,        854941,      49461235,           3,        79, nullptr},
-    { 57,        521808,      49738353,           3,        79, nullptr},
-    { 42,         11792,      49744250,           9,        43, nullptr},
-    { 60,        412730,      50003680,           3,        87, nullptr},
-    { 81,         11792,      50027265,           9,        34, nullptr},
-    { 64,        297755,      50289643,           3,       110, nullptr},
-    { 42,         11792,      50310280,           9,        45, nullptr},
-    { 69,         73701,      50528437,           3,       106, nullptr},
-    { 42,         11792,      50593295,           9,        43, nullptr},
-    { 40,        227001,      50840933,           3,        80, nullptr},
-    { 28,       1559530,      50852725,           1,       118, nullptr},
-    { 68,       1506465,      50873361,           4,       102, nullptr},
-    { 42,         11792,      50876310,           9,        53, nullptr},
-    { 52,        344924,      51126896,           3,        87, nullptr},
-    { 42,         11792,      51159325,           9,        45, nullptr},
-    { 42,         11792,      51442340,           9,        43, nullptr},
-    { 56,        144455,      51445288,           3,        47, nullptr},
-    { 64,        359664,      51707666,           3,        94, nullptr},
-    { 81,         11792,      51725355,           9,        34, nullptr},
-    { 72,        333132,      51972993,           3,       112, nullptr},
-    { 42,         11792,      52008370,           9,        45, nullptr},
-    { 71,         82546,      52250111,           3,       106, nullptr},
-    { 35,         11792,      52291385,           9,        79, nullptr},
-    { 60,        940435,      52494802,           2,        87, nullptr},
-    { 45,        704589,      52562607,           3,        79, nullptr},
-    { 72,        884421,      52571451,           4,       102, nullptr},
-    { 33,        787135,      52574400,           1,       118, nullptr},
-    { 52,        536549,      52854466,           3,        75, nullptr},
-    { 42,         11792,      52857414,           9,        45, nullptr},
-    { 42,         11792,      53140429,           9,        43, nullptr},
-    { 57,        197520,      53155170,           3,        78, nullptr},
-    { 55,        869681,      53423444,           2,        69, nullptr},
-    { 67,        589614,      53429341,           4,       102, nullptr},
-    { 81,         11792,      53438185,           9,        25, nullptr},
-    { 42,         11792,      53706459,           9,        45, nullptr},
-    { 72,        339028,      53712356,           3,       127, nullptr},
-    { 81,         11792,      53986526,           9,        35, nullptr},
-    { 42,         11792,      53989474,           9,        43, nullptr},
-    { 74,        356716,      53992423,           3,       127, nullptr},
-    { 36,       1471088,      54266593,           1,       124, nullptr},
-    { 72,       1506465,      54269541,           4,       102, nullptr},
-    { 35,         11792,      54272489,           9,       103, nullptr},
-    { 76,        893266,      54278386,           3,       114, nullptr},
-    { 48,        542445,      54290178,           3,        83, nullptr},
-    { 42,         11792,      54555504,           9,        45, nullptr},
-    { 55,        374405,      54570245,           3,        92, nullptr},
-    { 42,         11792,      54838519,           9,        43, nullptr},
-    { 60,        156247,      54847364,           3,        98, nullptr},
-    { 81,         11792,      55121534,           9,        34, nullptr},
-    { 67,        386197,      55127431,           3,       110, nullptr},
-    { 42,         11792,      55404549,           9,        45, nullptr},
-    { 77,        330184,      55410446,           3,       114, nullptr},
-    { 76,        374405,      55678720,           3,       118, nullptr},
-    { 35,         11792,      55687564,           9,        79, nullptr},
-    { 62,       1456348,      55967631,           4,       102, nullptr},
-    { 42,         11792,      55970579,           9,        53, nullptr},
-    { 31,        695745,      55973528,           1,       120, nullptr},
-    { 71,       1382646,      55976476,           2,        86, nullptr},
-    { 43,        262378,      56003008,           3,        81, nullptr},
-    { 74,        409782,      56005956,           2,        76, nullptr},
-    { 42,         11792,      56253594,           9,        45, nullptr},
-    { 55,        265326,      56268335,           3,        84, nullptr},
-    { 42,         11792,      56536609,           9,        43, nullptr},
-    { 59,         94338,      56586727,           3,        59, nullptr},
-    { 56,        869681,      56790144,           2,        85, nullptr},
-    { 68,        769447,      56816676,           2,        83, nullptr},
-    { 37,         11792,      56819624,           9,        82, nullptr},
-    { 32,        698693,      56822573,           1,       123, nullptr},
-    { 65,        321339,      56837313,           3,        90, nullptr},
-    { 42,         11792,      57102639,           9,        45, nullptr},
-    { 76,        288911,      57123276,           3,        90, nullptr},
-    { 42,         11792,      57385654,           9,        43, nullptr},
-    { 74,        315443,      57391551,           3,        94, nullptr},
-    { 69,       1370853,      57668669,           4,       102, nullptr},
-    { 72,        477587,      57671618,           3,        87, nullptr},
-    { 33,       1167436,      57677514,           1,       120, nullptr},
-    { 45,        571926,      57704046,           3,        60, nullptr},
-    { 42,         11792,      57951684,           9,        45, nullptr},
-    { 52,        389145,      57963477,           3,        84, nullptr},
-    { 42,         11792,      58234699,           9,        43, nullptr},
-    { 57,        132663,      58249440,           3,        82, nullptr},
-    { 37,         11792,      58517714,           9,        82, nullptr},
-    { 64,        227001,      58538351,           3,        82, nullptr},
-    { 42,         11792,      58800729,           9,        45, nullptr},
-    { 74,        274170,      58839054,           3,        88, nullptr},
-    { 35,         11792,      59083744,           9,        79, nullptr},
-    { 33,        283014,      59095537,           1,       123, nullptr},
-    { 72,        156247,      59098485,           3,       104, nullptr},
-    { 68,       1689245,      59366759,           4,       102, nullptr},
-    { 28,       3414909,      59375604,           1,       121, nullptr},
-    { 71,        324288,      59384448,           3,        92, nullptr},
-    { 52,        132663,      59649774,           3,        92, nullptr},
-    { 64,         76649,      59932789,           3,        85, nullptr},
-    { 64,        259430,      60215804,           3,       110, nullptr},
-    { 76,        120870,      60528300,           3,       120, nullptr},
-    { 64,        224053,      60802471,           3,       108, nullptr},
-    { 76,         91390,      61067798,           3,       120, nullptr},
-    { 76,        339028,      61341968,           3,       125, nullptr},
-    { 88,        103182,      61633828,           3,       115, nullptr},
-    { 75,        300703,      61905050,           3,       106, nullptr},
-    { 76,        129715,      62185117,           3,       104, nullptr},
-    { 75,        304114,      62471080,           3,       114, nullptr},
-    { 76,        308855,      62748199,           3,       106, nullptr},
-    { 75,        376834,      63081564,           3,        96, nullptr},
-    { 76,        376834,      63378743,           3,        92, nullptr},
-    { 71,         39828,      63663667,           3,        90, nullptr},
-    { 74,        321688,      63957782,           3,        92, nullptr},
-    { 33,       1697288,      64527629,           1,       115, nullptr},
-    { 76,       1473638,      64530693,           4,       102, nullptr},
-    { 69,        349261,      64552139,           3,        84, nullptr},
-    { 45,        511637,      64567458,           3,        69, nullptr},
-    { 42,         12254,      64821744,           9,        45, nullptr},
-    { 52,        275732,      64852381,           3,        69, nullptr},
-    { 42,         12254,      65115859,           9,        43, nullptr},
-    { 57,        147057,      65140369,           3,        81, nullptr},
-    { 81,         12254,      65409974,           9,        34, nullptr},
-    { 60,        343134,      65434484,           3,        90, nullptr},
-    { 42,         12254,      65704089,           9,        45, nullptr},
-    { 64,        343134,      65722472,           3,        94, nullptr},
-    { 35,         12254,      65998204,           9,        81, nullptr},
-    { 69,        107229,      66004332,           3,       110, nullptr},
-    { 28,       1602314,      66258619,           1,       116, nullptr},
-    { 74,       1583931,      66289256,           4,       102, nullptr},
-    { 42,         12254,      66292319,           9,        53, nullptr},
-    { 83,       1715670,      66307638,           2,        92, nullptr},
-    { 71,        404408,      66313765,           2,        93, nullptr},
-    { 40,        266541,      66344402,           3,        70, nullptr},
-    { 42,         12254,      66586434,           9,        45, nullptr},
-    { 52,        278796,      66607880,           3,        87, nullptr},
-    { 42,         12254,      66880549,           9,        43, nullptr},
-    { 56,        131739,      66895868,           3,        89, nullptr},
-    { 81,         12254,      67174664,           9,        34, nullptr},
-    { 64,        398280,      67180792,           3,       102, nullptr},
-    { 68,        355388,      67459588,           3,       110, nullptr},
-    { 42,         12254,      67468779,           9,        45, nullptr},
-    { 71,        125611,      67747576,           3,       110, nullptr},
-    { 42,         12254,      67762894,           9,        43, nullptr},
-    { 84,       1093821,      68001863,           2,        84, nullptr},
-    { 33,       1747960,      68023309,           1,       116, nullptr},
-    { 69,       3011947,      68053946,           4,       102, nullptr},
-    { 46,         11904,      68057009,           9,        45, nullptr},
-    { 45,        550586,      68077843,           3,        78, nullptr},
-    { 52,        389875,      68360576,           3,        80, nullptr},
-    { 57,        166664,      68676048,           3,        72, nullptr},
-    { 64,        133926,      68952829,           3,        90, nullptr},
-    { 76,        315471,      69244492,           3,       106, nullptr},
-    { 75,        345232,      69503416,           3,       106, nullptr},
-    { 76,        318447,      69789126,           3,        94, nullptr},
-    { 75,        327376,      70062932,           3,       116, nullptr},
-    { 76,        372018,      70342689,           3,       102, nullptr},
-    { 47,        333328,      70583757,           2,        96, nullptr},
-    { 59,        363089,      70586733,           2,        96, nullptr},
-    { 71,        357137,      70619471,           3,       108, nullptr},
-    { 50,        294638,      70893276,           2,       100, nullptr},
-    { 62,        333328,      70905181,           2,       100, nullptr},
-    { 48,        336304,      71149225,           2,        97, nullptr},
-    { 60,        300590,      71176010,           2,       106, nullptr},
-    { 76,       1410693,      71482553,           4,       102, nullptr},
-    { 33,       1556524,      71485529,           1,       115, nullptr},
-    { 45,        595229,      71494458,           3,        74, nullptr},
-    { 42,         11904,      71771239,           9,        45, nullptr},
-    { 52,        339280,      71780168,           3,        76, nullptr},
-    { 57,        119045,      72050997,           3,        86, nullptr},
-    { 42,         11904,      72056949,           9,        43, nullptr},
-    { 60,        321423,      72327779,           3,       106, nullptr},
-    { 42,         11904,      72342659,           9,        44, nullptr},
-    { 64,        330352,      72610513,           3,       106, nullptr},
-    { 42,         11904,      72628369,           9,        45, nullptr},
-    { 69,         68451,      72890270,           3,       112, nullptr},
-    { 42,         11904,      72914080,           9,        43, nullptr},
-    { 28,       1574381,      73175980,           1,       118, nullptr},
-    { 83,       1779735,      73184909,           2,        81, nullptr},
-    { 40,        261900,      73190861,           2,        92, nullptr},
-    { 74,       1657713,      73196813,           4,       102, nullptr},
-    { 71,        330352,      73199790,           4,       102, nullptr},
-    { 52,        205354,      73476571,           3,        83, nullptr},
-    { 42,         11904,      73485500,           9,        45, nullptr},
-    { 42,         11904,      73771210,           9,        43, nullptr},
-    { 56,        127974,      73777162,           3,        76, nullptr},
-    { 37,         11904,      74056920,           9,        82, nullptr},
-    { 64,        303566,      74068824,           3,        92, nullptr},
-    { 42,         11904,      74342630,           9,        45, nullptr},
-    { 72,        336304,      74354534,           3,        96, nullptr},
-    { 35,         11904,      74628340,           9,        79, nullptr},
-    { 71,         56546,      74634292,           3,        92, nullptr},
-    { 81,        860106,      74884288,           2,        86, nullptr},
-    { 33,        794630,      74914050,           1,       118, nullptr},
-    { 69,        386898,      74922978,           3,        96, nullptr},
-    { 45,        407731,      74937859,           3,        76, nullptr},
-    { 42,         11904,      75199760,           9,        45, nullptr},
-    { 52,        249996,      75211664,           3,        78, nullptr},
-    { 42,         11904,      75485470,           9,        43, nullptr},
-    { 57,         50594,      75494398,           3,        83, nullptr},
-    { 46,         11904,      75771180,           9,        34, nullptr},
-    { 34,        175592,      75783084,           1,       126, nullptr},
-    { 81,         11904,      75786060,           9,        25, nullptr},
-    { 64,        101188,      75797965,           4,       102, nullptr},
-    { 72,        113093,      75806893,           4,       102, nullptr},
-    { 58,         32737,      75824750,           2,       121, nullptr},
-    { 70,        288686,      75839631,           2,       121, nullptr},
-    { 45,         11904,      76056890,           9,        45, nullptr},
-    { 81,         11904,      76062842,           9,        28, nullptr},
-    { 72,        110117,      76068794,           3,       127, nullptr},
-    { 33,        181544,      76071770,           1,       121, nullptr},
-    { 65,         89284,      76077723,           3,       110, nullptr},
-    { 57,         56546,      76098556,           2,       123, nullptr},
-    { 69,        279757,      76125341,           2,       122, nullptr},
-    { 81,         11904,      76339623,           9,        35, nullptr},
-    { 41,         11904,      76342600,           9,        43, nullptr},
-    { 31,        208330,      76354504,           1,       123, nullptr},
-    { 55,         68451,      76360456,           3,       110, nullptr},
-    { 67,         17856,      76363433,           2,       119, nullptr},
-    { 35,         11904,      76628310,           9,       103, nullptr},
-    { 69,        157735,      76631286,           3,       114, nullptr},
-    { 72,       1217243,      76637238,           3,       118, nullptr},
-    { 29,       1142840,      76640214,           1,       123, nullptr},
-    { 53,       1336289,      76643190,           3,        84, nullptr},
-    { 42,         11904,      76914020,           9,        45, nullptr},
-    { 57,        279757,      76928900,           3,        78, nullptr},
-    { 42,         11904,      77199730,           9,        43, nullptr},
-    { 60,        306543,      77232467,           3,        79, nullptr},
-    { 40,         11904,      77485440,           9,        78, nullptr},
-    { 57,        247020,      77512225,           3,        75, nullptr},
-    { 42,         11904,      77771150,           9,        45, nullptr},
-    { 60,        116069,      77786030,           3,        79, nullptr},
-    { 77,        372018,      77789006,           3,       123, nullptr},
-    { 57,        309519,      78053883,           3,        83, nullptr},
-    { 35,         11904,      78056860,           9,        79, nullptr},
-    { 29,        300590,      78059836,           1,       120, nullptr},
-    { 76,         95236,      78089597,           3,       118, nullptr},
-    { 65,       1354146,      78342570,           4,       102, nullptr},
-    { 53,       1476168,      78345546,           3,        79, nullptr},
-    { 76,        562491,      78351498,           3,       125, nullptr},
-    { 34,       1163673,      78360426,           1,       120, nullptr},
-    { 42,         11904,      78628280,           9,        45, nullptr},
-    { 58,        285709,      78631256,           3,        78, nullptr},
-    { 62,        288686,      78911013,           3,        70, nullptr},
-    { 42,         11904,      78913990,           9,        43, nullptr},
-    { 74,        196425,      78919942,           3,       104, nullptr},
-    { 58,        294638,      79193747,           3,        66, nullptr},
-    { 42,         11904,      79199700,           9,        44, nullptr},
-    { 42,         11904,      79485410,           9,        45, nullptr},
-    { 62,        386898,      79491362,           3,        69, nullptr},
-    { 82,        354161,      79494338,           3,       120, nullptr},
-    { 58,        389875,      79768143,           3,        73, nullptr},
-    { 42,         11904,      79771120,           9,        43, nullptr},
-    { 81,         92260,      79848499,           3,       112, nullptr},
-    { 29,       1235100,      80044925,           1,       115, nullptr},
-    { 65,       1485096,      80053853,           4,       102, nullptr},
-    { 42,         11904,      80056830,           9,        53, nullptr},
-    { 53,        318447,      80059806,           3,        80, nullptr},
-    { 81,        369042,      80062782,           3,       118, nullptr},
-    { 79,        363089,      80342540,           3,       112, nullptr},
-    { 64,        419636,      80345516,           3,        78, nullptr},
-    { 42,         11904,      80628250,           9,        43, nullptr},
-    { 77,        291662,      80631226,           3,       104, nullptr},
-    { 58,        276781,      80643130,           3,        73, nullptr},
-    { 76,        333328,      80905031,           3,       100, nullptr},
-    { 42,         11904,      80913960,           9,        44, nullptr},
-    { 64,        372018,      80916936,           3,        86, nullptr},
-    { 74,        264876,      81190741,           3,        96, nullptr},
-    { 42,         11904,      81199670,           9,        45, nullptr},
-    { 58,        270829,      81217526,           3,        73, nullptr},
-    { 53,        199401,      81226455,           3,        70, nullptr},
-    { 55,        193449,      81229431,           3,        75, nullptr},
-    { 72,         47618,      81467523,           3,        90, nullptr},
-    { 29,        223210,      81470499,           1,       124, nullptr},
-    { 35,         11904,      81485380,           9,        79, nullptr},
-    { 64,        339280,      81491332,           3,        72, nullptr},
-    { 70,        675585,      81762161,           3,        90, nullptr},
-    { 72,          2976,      81768113,           4,       102, nullptr},
-    { 65,       1482120,      81771090,           2,        96, nullptr},
-    { 29,       1255933,      81774066,           1,       122, nullptr},
-    { 53,       1377955,      81777042,           3,        71, nullptr},
-    { 42,         11904,      82056800,           9,        37, nullptr},
-    { 57,        315471,      82065728,           3,        73, nullptr},
-    { 42,         11904,      82342510,           9,        43, nullptr},
-    { 69,        104165,      82351438,           3,        87, nullptr},
-    { 60,        270829,      82363343,           3,        73, nullptr},
-    { 40,         11904,      82628220,           9,        78, nullptr},
-    { 57,        315471,      82634172,           3,        77, nullptr},
-    { 70,        160711,      82785955,           3,        90, nullptr},
-    { 42,         11904,      82913930,           9,        45, nullptr},
-    { 69,        157735,      82916906,           3,        94, nullptr},
-    { 60,        321423,      82943691,           3,        85, nullptr},
-    { 67,        214282,      83068689,           3,       110, nullptr},
-    { 29,        226187,      83175830,           1,       122, nullptr},
-    { 42,         11904,      83199640,           9,        43, nullptr},
-    { 69,             0,      83217496,           3,       106, nullptr},
-    { 57,        279757,      83229401,           3,        74, nullptr},
-    { 70,        193449,      83357375,           3,       102, nullptr},
-    { 41,       1318432,      83473445,           1,       114, nullptr},
-    { 65,       1318432,      83482373,           4,       102, nullptr},
-    { 35,         11904,      83485350,           9,       103, nullptr},
-    { 72,       1238076,      83500230,           3,       108, nullptr},
-    { 53,       1401764,      83512135,           3,        78, nullptr},
-    { 42,         11904,      83771060,           9,        45, nullptr},
-    { 57,        247020,      83830582,           3,        73, nullptr},
-    { 42,         11904,      84056770,           9,        43, nullptr},
-    { 60,        330352,      84092483,           3,        83, nullptr},
-    { 40,         11904,      84342480,           9,        78, nullptr},
-    { 57,        291662,      84366289,           3,        83, nullptr},
-    { 42,         11904,      84628190,           9,        45, nullptr},
-    { 60,        339280,      84646046,           3,        79, nullptr},
-    { 75,        380946,      84901995,           3,       114, nullptr},
-    { 35,         11904,      84913900,           9,        81, nullptr},
-    { 57,        315471,      84931756,           3,        73, nullptr},
-    { 69,        758917,      85196633,           4,       102, nullptr},
-    { 35,         11904,      85199610,           9,       103, nullptr},
-    { 76,        565467,      85202586,           3,       108, nullptr},
-    { 40,        782726,      85208538,           1,       114, nullptr},
-    { 52,        791654,      85217466,           3,        79, nullptr},
-    { 42,         11904,      85485320,           9,        45, nullptr},
-    { 57,        282733,      85503176,           3,        90, nullptr},
-    { 42,         11904,      85771030,           9,        43, nullptr},
-    { 60,        291662,      85776982,           3,        94, nullptr},
-    { 76,        354161,      86035906,           3,       123, nullptr},
-    { 57,        249996,      86047811,           3,        88, nullptr},
-    { 65,        571420,      86056740,           4,       102, nullptr},
-    { 74,        580348,      86062692,           2,       106, nullptr},
-    { 38,        630942,      86077573,           1,       111, nullptr},
-    { 77,        392851,      86339473,           3,       106, nullptr},
-    { 42,         11904,      86342450,           9,        45, nullptr},
-    { 62,        360113,      86345426,           3,        84, nullptr},
-    { 50,        321423,      86351378,           3,        75, nullptr},
-    { 35,         11904,      86628160,           9,        79, nullptr},
-    { 69,         89284,      86631136,           3,       114, nullptr},
-    { 57,         89284,      86640064,           3,        96, nullptr},
-    { 36,        741060,      86896013,           1,       109, nullptr},
-    { 42,         11904,      86913870,           9,        53, nullptr},
-    { 67,        598205,      86928750,           2,       121, nullptr},
-    { 55,        294638,      86940655,           3,        85, nullptr},
-    { 42,         11904,      87199580,           9,        45, nullptr},
-    { 64,        303566,      87208508,           3,        87, nullptr},
-    { 74,        172616,      87485290,           3,       108, nullptr},
-    { 55,        205354,      87491242,           3,        90, nullptr},
-    { 72,        142854,      87634097,           3,       108, nullptr},
-    { 31,        684513,      87762071,           1,       123, nullptr},
-    { 64,        306543,      87765047,           3,        70, nullptr},
-    { 40,         11904,      87771000,           9,        78, nullptr},
-    { 67,        562491,      87779928,           2,       109, nullptr},
-    { 62,        553563,      87791833,           2,       119, nullptr},
-    { 71,        145831,      87794809,           2,       118, nullptr},
-    { 72,        172616,      87887069,           3,       106, nullptr},
-    { 74,        130950,      88029924,           3,       110, nullptr},
-    { 42,         11904,      88056710,           9,        45, nullptr},
-    { 55,        199401,      88062662,           3,        88, nullptr},
-    { 65,         80355,      88333491,           3,        90, nullptr},
-    { 35,         11904,      88342420,           9,        79, nullptr},
-    { 71,        119045,      88384086,           3,        96, nullptr},
-    { 36,        494040,      88613249,           1,       125, nullptr},
-    { 60,        107141,      88628130,           3,        84, nullptr},
-    { 64,         86308,      88634082,           3,        90, nullptr},
-    { 72,        160711,      88637058,           3,       114, nullptr},
-    { 79,        148807,      88770985,           3,       118, nullptr},
-    { 67,        119045,      88919792,           3,       106, nullptr},
-    { 79,        133926,      89062647,           3,       114, nullptr},
-    { 42,         11904,      89199550,           9,        43, nullptr},
-    { 69,        113093,      89214430,           3,        94, nullptr},
-    { 79,        116069,      89351333,           3,       102, nullptr},
-    { 41,        199401,      89470379,           1,       124, nullptr},
-    { 67,          5952,      89479307,           4,       102, nullptr},
-    { 40,         11904,      89485260,           9,        78, nullptr},
-    { 67,         56546,      89491212,           3,        82, nullptr},
-    { 71,        110117,      89494188,           3,       100, nullptr},
-    { 65,         32737,      89509069,           3,        61, nullptr},
-    { 79,        104165,      89637043,           3,        89, nullptr},
-    { 40,        172616,      89770970,           1,       124, nullptr},
-    { 67,         77379,      89785850,           3,        90, nullptr},
-    { 79,        127974,      89904896,           3,        92, nullptr},
-    { 35,         11904,      90056680,           9,        81, nullptr},
-    { 38,        133926,      90062632,           1,       121, nullptr},
-    { 79,        139878,      90175725,           3,        92, nullptr},
-    { 76,        199401,      90330485,           3,       114, nullptr},
-    { 62,        229163,      90342390,           4,       102, nullptr},
-    { 64,         74403,      90345366,           3,        94, nullptr},
-    { 36,        425588,      90348342,           1,       126, nullptr},
-    { 79,        157735,      90485245,           3,       106, nullptr},
-    { 84,        196425,      90610243,           3,       114, nullptr},
-    { 42,         11904,      90628100,           9,        45, nullptr},
-    { 83,        184521,      90759050,           3,       123, nullptr},
-    { 72,         53570,      90770955,           2,       102, nullptr},
-    { 81,        211222,      90895953,           3,       120, nullptr},
-    { 69,        488228,      90907857,           4,       102, nullptr},
-    { 35,         11904,      90913810,           9,        80, nullptr},
-    { 57,        635520,      90919762,           3,        94, nullptr},
-    { 79,        124184,      91059641,           3,       108, nullptr},
-    { 77,        162144,      91195617,           3,       110, nullptr},
-    { 42,         11792,      91198565,           9,        44, nullptr},
-    { 76,        206365,      91322384,           3,       110, nullptr},
-    { 67,        386197,      91478632,           4,       102, nullptr},
-    { 35,         11792,      91481580,           9,        79, nullptr},
-    { 31,        409782,      91484528,           1,       124, nullptr},
-    { 74,        162144,      91493372,           3,        92, nullptr},
-    { 59,        409782,      91499268,           3,        65, nullptr},
-    { 55,        383249,      91514009,           3,        67, nullptr},
-    { 79,        179832,      91643724,           3,        98, nullptr},
-    { 42,         11792,      91764595,           9,        43, nullptr},
-    { 77,        156247,      91805868,           3,        84, nullptr},
-    { 74,         73701,      91923791,           3,        87, nullptr},
-    { 64,        680316,      92035818,           2,       105, nullptr},
-    { 35,         11792,      92047610,           9,        79, nullptr},
-    { 33,        633449,      92050558,           1,       126, nullptr},
-    { 52,        779338,      92065298,           3,        79, nullptr},
-    { 42,         11682,      92330625,           9,        37, nullptr},
-    { 57,        277449,      92348148,           3,        90, nullptr},
-    { 42,         11682,      92610995,           9,        43, nullptr},
-    { 60,        286211,      92616836,           3,        94, nullptr},
-    { 65,        858633,      92844637,           2,       106, nullptr},
-    { 76,        347541,      92870921,           3,       123, nullptr},
-    { 38,        686322,      92873842,           1,       124, nullptr},
-    { 57,        245323,      92882603,           3,        88, nullptr},
-    { 74,        525693,      92888445,           4,       102, nullptr},
-    { 40,         11682,      92891365,           9,        78, nullptr},
-    { 77,        242403,      93168815,           3,       106, nullptr},
-    { 42,         11682,      93171735,           9,        45, nullptr},
-    { 62,        344621,      93174656,           3,        84, nullptr},
-    { 50,        315416,      93180497,           3,        75, nullptr},
-    { 35,         11682,      93452105,           9,        79, nullptr},
-    { 69,        183992,      93455026,           3,       114, nullptr},
-    { 57,         87615,      93463787,           3,        96, nullptr},
-    { 36,        753494,      93729555,           1,       123, nullptr},
-    { 42,         11682,      93732475,           9,        53, nullptr},
-    { 72,        554898,      93744157,           3,       123, nullptr},
-    { 55,        289131,      93749998,           3,        85, nullptr},
-    { 42,         11682,      94012845,           9,        45, nullptr},
-    { 64,        297893,      94021607,           3,        87, nullptr},
-    { 74,        169390,      94293215,           3,       108, nullptr},
-    { 55,        201515,      94299056,           3,        90, nullptr},
-    { 72,         43807,      94439241,           3,       108, nullptr},
-    { 62,        806063,      94538539,           2,       110, nullptr},
-    { 64,        300813,      94567744,           3,        70, nullptr},
-    { 67,        633753,      94570665,           4,       102, nullptr},
-    { 31,        511091,      94573585,           1,       122, nullptr},
-    { 72,        169390,      94687485,           3,       106, nullptr},
-    { 74,        128502,      94827670,           3,       110, nullptr},
-    { 42,         11682,      94853955,           9,        45, nullptr},
-    { 55,        195674,      94859796,           3,        88, nullptr},
-    { 65,         78854,      95125563,           3,        90, nullptr},
-    { 31,        277449,      95134325,           1,       113, nullptr},
-    { 71,          8761,      95175212,           3,        96, nullptr},
-    { 76,        566581,      95411775,           4,       102, nullptr},
-    { 36,        481885,      95414695,           1,       125, nullptr},
-    { 60,        335859,      95423457,           3,        77, nullptr},
-    { 72,        119741,      95429298,           3,        90, nullptr},
-    { 64,         32125,      95540277,           3,        58, nullptr},
-    { 79,        116820,      95569483,           3,        86, nullptr},
-    { 67,        108059,      95695065,           3,       112, nullptr},
-    { 79,        131423,      95835250,           3,       125, nullptr},
-    { 42,         11682,      95975435,           9,        43, nullptr},
-    { 69,        110979,      95990038,           3,       108, nullptr},
-    { 79,        134343,      96130223,           3,       125, nullptr},
-    { 41,        195674,      96255805,           1,       124, nullptr},
-    { 67,         37966,      96264567,           3,        98, nullptr},
-    { 65,         73013,      96267487,           3,       102, nullptr},
-    { 71,        105138,      96270408,           3,        94, nullptr},
-    { 72,         26284,      96378467,           3,        94, nullptr},
-    { 79,        122661,      96407672,           3,       110, nullptr},
-    { 40,        169390,      96536175,           1,       124, nullptr},
-    { 64,         75933,      96544937,           3,       108, nullptr},
-    { 72,         96377,      96547857,           3,       116, nullptr},
-    { 79,        125582,      96690963,           3,       106, nullptr},
-    { 38,        131423,      96816545,           1,       121, nullptr},
-    { 62,         75933,      96822386,           3,       114, nullptr},
-    { 74,        108059,      96828227,           3,       110, nullptr},
-    { 79,        113900,      96965492,           3,       112, nullptr},
-    { 72,        432237,      97096915,           4,       102, nullptr},
-    { 60,         84695,      97099836,           3,       118, nullptr},
-    { 76,        195674,      97105677,           3,       114, nullptr},
-    { 79,        154787,      97257544,           3,       108, nullptr},
-    { 84,        195674,      97377285,           3,       114, nullptr},
-    { 83,        163549,      97526232,           3,       120, nullptr},
-    { 57,        569501,      97637211,           3,        80, nullptr},
-    { 81,        189833,      97645973,           3,       120, nullptr},
-    { 29,        461442,      97657655,           1,       124, nullptr},
-    { 65,        341700,      97663496,           2,       101, nullptr},
-    { 72,        335859,      97666417,           2,       101, nullptr},
-    { 69,        367985,      97669337,           2,       114, nullptr},
-    { 79,        116820,      97797840,           3,       108, nullptr},
-    { 77,        195674,      97929263,           3,       106, nullptr},
-    { 42,         11682,      97938025,           9,        44, nullptr},
-    { 76,        143105,      98072369,           3,        96, nullptr},
-    { 59,        312495,      98186269,           3,        79, nullptr},
-    { 31,        405952,      98218395,           1,       124, nullptr},
-    { 79,        172310,      98349818,           3,       114, nullptr},
-    { 77,        186913,      98495845,           3,        92, nullptr},
-    { 42,         11682,      98498765,           9,        43, nullptr},
-    { 74,        169390,      98647712,           3,        94, nullptr},
-    { 64,       1880815,      98767453,           2,        97, nullptr},
-    { 28,       1682219,      98779135,           1,       126, nullptr},
-    { 56,       1693902,      98787897,           3,        69, nullptr},
-    { 68,       1495306,      98793738,           2,        97, nullptr},
-    { 77,        172310,      98968969,           3,        88, nullptr},
-    { 76,        148946,      99100392,           3,        92, nullptr},
-    { 75,        183992,      99234736,           3,        92, nullptr},
-    { 76,        128502,      99372001,           3,       110, nullptr},
-    { 71,        195674,      99488822,           3,       100, nullptr},
-    { 76,        166469,      99626086,           3,       120, nullptr},
-    { 81,         11682,      99634848,           9,        30, nullptr},
-    { 75,        172310,      99766271,           3,       104, nullptr},
-    { 76,        125582,      99903536,           3,       108, nullptr},
-    { 71,        172310,     100032038,           3,       106, nullptr},
-    { 76,        157708,     100169303,           3,       106, nullptr},
-    { 75,        146026,     100309488,           3,        92, nullptr},
-    { 76,        955010,     100467196,           3,       110, nullptr},
-    { 81,         11682,     100478878,           9,        32, nullptr},
-    { 71,        420554,     101319988,           3,        94, nullptr},
-    { 76,        335859,     101603279,           3,       120, nullptr},
-    { 75,        371925,     101880728,           3,       108, nullptr},
-    { 81,         11792,     102143575,           9,        34, nullptr},
-    { 76,        840200,     102167160,           3,        96, nullptr},
-    { 71,        333132,     103010308,           3,        84, nullptr},
-    { 76,        229949,     103296272,           3,        96, nullptr},
-    { 75,        294807,     103567494,           3,       104, nullptr},
-    { 76,        294807,     103844613,           3,       100, nullptr},
-    { 75,        321339,     104115836,           3,        96, nullptr},
-    { 76,        294864,     104398851,           3,       108, nullptr},
-    { 71,        297020,     104667125,           3,        94, nullptr},
-    { 74,        300479,     104970156,           3,        98, nullptr},
-    { 76,       1385208,     105553085,           4,       102, nullptr},
-    { 33,       1664654,     105556090,           1,       115, nullptr},
-    { 45,        736173,     105574119,           3,        69, nullptr},
-    { 42,         12019,     105844550,           9,        45, nullptr},
-    { 52,        588939,     105853564,           3,        78, nullptr},
-    { 42,         12019,     106133010,           9,        43, nullptr},
-    { 57,        231368,     106142024,           3,        76, nullptr},
-    { 60,        390622,     106418465,           3,        86, nullptr},
-    { 81,         12019,     106421470,           9,        34, nullptr},
-    { 64,        324517,     106700916,           3,       104, nullptr},
-    { 42,         12019,     106709930,           9,        45, nullptr},
-    { 69,          9014,     106950313,           3,       104, nullptr},
-    { 42,         12019,     106998390,           9,        43, nullptr},
-    { 28,       1633052,     107253797,           1,       116, nullptr},
-    { 40,        290144,     107274831,           3,        85, nullptr},
-    { 71,        568509,     107280840,           4,       102, nullptr},
-    { 74,       1606129,     107283845,           4,       102, nullptr},
-    { 35,         12500,     107286850,           9,       103, nullptr},
-    { 52,        340625,     107568100,           3,        88, nullptr},
-    { 42,         12500,     107586850,           9,        45, nullptr},
-    { 42,         12500,     107886850,           9,        43, nullptr},
-    { 56,        153125,     107889975,           3,        79, nullptr},
-    { 64,        381250,     108186850,           3,       100, nullptr},
-    { 68,        353125,     108474350,           3,       108, nullptr},
-    { 42,         12500,     108486850,           9,        45, nullptr},
-    { 71,        181250,     108743100,           3,       112, nullptr},
-    { 42,         12500,     108786850,           9,        43, nullptr},
-    { 33,       1781934,     109052475,           1,       116, nullptr},
-    { 69,       1805387,     109080600,           4,       102, nullptr},
-    { 46,         12135,     109086850,           9,        45, nullptr},
-    { 45,        706912,     109095952,           3,        80, nullptr},
-    { 52,        424754,     109381144,           3,        80, nullptr},
-    { 57,        166867,     109684540,           3,        79, nullptr},
-    { 64,        385312,     109969732,           3,        92, nullptr},
-    { 76,        345871,     110267060,           3,       112, nullptr},
-    { 75,        288226,     110543150,           3,       112, nullptr},
-    { 76,        348905,     110831376,           3,       104, nullptr},
-    { 75,        169901,     111116568,           3,       100, nullptr},
-    { 76,        166867,     111416930,           3,       100, nullptr},
-    { 71,        351939,     111714258,           3,        87, nullptr},
-    { 74,        309463,     112008552,           3,        92, nullptr},
-    { 76,       1492707,     112578936,           4,       102, nullptr},
-    { 33,       1586760,     112581970,           1,       115, nullptr},
-    { 69,        373176,     112588038,           3,        84, nullptr},
-    { 45,        624995,     112603208,           3,        70, nullptr},
-    { 42,         12135,     112873230,           9,        45, nullptr},
-    { 52,        391380,     112888400,           3,        79, nullptr},
-    { 42,         12135,     113164490,           9,        43, nullptr},
-    { 57,        154731,     113170558,           3,        84, nullptr},
-    { 60,        382278,     113443614,           3,        98, nullptr},
-    { 37,         12135,     113455750,           9,        82, nullptr},
-    { 64,        288226,     113747010,           3,       100, nullptr},
-    { 42,         12135,     114038270,           9,        43, nullptr},
-    { 69,         81916,     114065576,           3,       108, nullptr},
-    { 28,       1604963,     114305258,           1,       118, nullptr},
-    { 68,       1577658,     114326496,           4,       102, nullptr},
-    { 42,         12135,     114329530,           9,        53, nullptr},
-    { 71,        527908,     114335598,           3,       110, nullptr},
-    { 40,        245750,     114359870,           3,        87, nullptr},
-    { 42,         12135,     114620790,           9,        45, nullptr},
-    { 52,        270022,     114629892,           3,        94, nullptr},
-    { 42,         12135,     114912050,           9,        43, nullptr},
-    { 56,        112256,     114927220,           3,        80, nullptr},
-    { 37,         12135,     115203310,           9,        82, nullptr},
-    { 64,        373176,     115209378,           3,       100, nullptr},
-    { 42,         12135,     115494570,           9,        45, nullptr},
-    { 72,        336769,     115497604,           3,       108, nullptr},
-    { 71,        103154,     115776728,           3,       106, nullptr},
-    { 42,         12135,     115785830,           9,        43, nullptr},
-    { 60,        967832,     115995173,           2,        87, nullptr},
-    { 64,        761523,     116074056,           4,       102, nullptr},
-    { 33,        810066,     116077090,           1,       118, nullptr},
-    { 69,        476331,     116080124,           3,        92, nullptr},
-    { 45,        394414,     116107430,           3,        76, nullptr},
-    { 42,         12135,     116368350,           9,        45, nullptr},
-    { 52,        324633,     116371384,           3,        84, nullptr},
-    { 42,         12135,     116659610,           9,        43, nullptr},
-    { 57,        139562,     116674780,           3,        84, nullptr},
-    { 55,        895017,     116950870,           2,        69, nullptr},
-    { 67,        770625,     116953904,           2,        87, nullptr},
-    { 62,        758489,     116956938,           2,        86, nullptr},
-    { 81,         12135,     116966040,           9,        25, nullptr},
-    { 71,        379244,     116972108,           3,       112, nullptr},
-    { 42,         12135,     117242130,           9,        45, nullptr},
-    { 81,         12135,     117248198,           9,        28, nullptr},
-    { 72,        254852,     117257300,           3,       123, nullptr},
-    { 81,         12135,     117530356,           9,        35, nullptr},
-    { 42,         12135,     117533390,           9,        43, nullptr},
-    { 74,        348905,     117536424,           3,       110, nullptr},
-    { 64,       1617099,     117806446,           2,        77, nullptr},
-    { 36,       1513945,     117818582,           1,       124, nullptr},
-    { 35,         12135,     117824650,           9,       103, nullptr},
-    { 72,       1541250,     117827684,           4,       102, nullptr},
-    { 76,        442957,     117833752,           3,       100, nullptr},
-    { 48,        570384,     117848922,           3,        79, nullptr},
-    { 42,         12135,     118115910,           9,        45, nullptr},
-    { 55,        394414,     118137148,           3,        86, nullptr},
-    { 42,         12135,     118407170,           9,        43, nullptr},
-    { 60,        151697,     118431442,           3,        87, nullptr},
-    { 37,         12135,     118698430,           9,        82, nullptr},
-    { 67,        385312,     118719668,           3,       102, nullptr},
-    { 42,         12135,     118989690,           9,        45, nullptr},
-    { 77,        358007,     119013962,           3,       112, nullptr},
-    { 76,          6067,     119277916,           3,       114, nullptr},
-    { 35,         12135,     119280950,           9,        79, nullptr},
-    { 67,        643199,     119569176,           4,       102, nullptr},
-    { 35,         12135,     119572210,           9,       103, nullptr},
-    { 31,        716014,     119575244,           1,       120, nullptr},
-    { 71,       1531392,     119578278,           2,        86, nullptr},
-    { 43,        276090,     119593448,           3,        79, nullptr},
-    { 74,        321599,     119608618,           2,        76, nullptr},
-    { 42,         12135,     119863470,           9,        45, nullptr},
-    { 55,        254852,     119878640,           3,        84, nullptr},
-    { 42,         12135,     120154730,           9,        43, nullptr},
-    { 59,        151697,     120169900,           3,        87, nullptr},
-    { 56,        878541,     120415650,           2,        85, nullptr},
-    { 68,        776831,     120442956,           2,        83, nullptr},
-    { 37,         11904,     120445990,           9,        82, nullptr},
-    { 32,        705346,     120448966,           1,       123, nullptr},
-    { 65,        339280,     120466823,           3,        92, nullptr},
-    { 42,         11904,     120731700,           9,        45, nullptr},
-    { 76,        327376,     120746581,           3,       100, nullptr},
-    { 42,         11904,     121017410,           9,        43, nullptr},
-    { 74,        160711,     121020386,           3,        96, nullptr},
-    { 69,       1461287,     121303120,           4,       102, nullptr},
-    { 76,       1389860,     121306096,           4,       102, nullptr},
-    { 72,        434517,     121309072,           3,        89, nullptr},
-    { 33,       1178553,     121312048,           1,       120, nullptr},
-    { 42,         11904,     121588830,           9,        45, nullptr},
-    { 52,        369042,     121612639,           3,        70, nullptr},
-    { 57,        133926,     121874540,           3,        80, nullptr},
-    { 81,         11904,     122160250,           9,        34, nullptr},
-    { 64,        315471,     122192988,           3,        84, nullptr},
-    { 42,         11904,     122445960,           9,        45, nullptr},
-    { 74,        273805,     122448936,           3,        85, nullptr},
-    { 42,         11904,     122731670,           9,        43, nullptr},
-    { 33,        285710,     122743575,           1,       123, nullptr},
-    { 72,        151783,     122752503,           3,        92, nullptr},
-    { 68,       1711283,     123011428,           4,       102, nullptr},
-    { 46,         11904,     123017380,           9,        43, nullptr},
-    { 28,       3446376,     123026308,           1,       121, nullptr},
-    { 71,        312495,     123032261,           3,        88, nullptr},
-    { 40,         92260,     123067974,           3,        83, nullptr},
-    { 52,        169640,     123332851,           3,        90, nullptr},
-    { 64,         62499,     123615585,           3,       105, nullptr},
-    { 64,        273805,     123883438,           3,       123, nullptr},
-    { 76,        110117,     124198910,           3,       113, nullptr},
-    { 64,        226187,     124466763,           3,       116, nullptr},
-    { 76,         98212,     124746521,           3,       116, nullptr},
-    { 76,        351185,     125026278,           3,       110, nullptr},
-    { 88,         86308,     125317941,           3,       108, nullptr},
-    { 75,        297614,     125594722,           3,       110, nullptr},
-    { 76,        124998,     125889361,           3,       103, nullptr},
-    { 75,        312495,     126169118,           3,        98, nullptr},
-    { 76,         29761,     126448876,           3,       100, nullptr},
-    { 75,        351185,     126716729,           3,       104, nullptr},
-    { 76,        377970,     127005415,           3,       102, nullptr},
-    { 71,        404755,     127291125,           3,        96, nullptr},
-    { 74,        288686,     127594692,           3,        98, nullptr},
-    { 33,       1680812,     128160160,           1,       115, nullptr},
-    { 45,        661402,     128172296,           3,        88, nullptr},
-    { 69,        370142,     128178364,           2,        50, nullptr},
-    { 42,         12135,     128451420,           9,        45, nullptr},
-    { 52,        354973,     128463556,           3,        88, nullptr},
-    { 42,         12135,     128742680,           9,        43, nullptr},
-    { 57,        154731,     128748748,           3,        80, nullptr},
-    { 81,         12135,     129033940,           9,        34, nullptr},
-    { 60,        318565,     129040008,           3,        87, nullptr},
-    { 42,         12135,     129325200,           9,        45, nullptr},
-    { 64,        342837,     129328234,           3,        96, nullptr},
-    { 69,         87984,     129604324,           3,       104, nullptr},
-    { 42,         12135,     129616460,           9,        43, nullptr},
-    { 59,       1805205,     129840973,           2,        75, nullptr},
-    { 28,       1586760,     129874346,           1,       116, nullptr},
-    { 74,       1447198,     129904686,           4,       102, nullptr},
-    { 42,         12135,     129907720,           9,        53, nullptr},
-    { 40,        257886,     129913788,           3,        79, nullptr},
-    { 52,        288226,     130195946,           3,        82, nullptr},
-    { 42,         12135,     130198980,           9,        45, nullptr},
-    { 56,        142596,     130481138,           3,        90, nullptr},
-    { 42,         12135,     130490240,           9,        43, nullptr},
-    { 64,        391380,     130772398,           3,       104, nullptr},
-    { 42,         12135,     130781500,           9,        44, nullptr},
-    { 68,        303395,     131060624,           3,       108, nullptr},
-    { 42,         12135,     131072760,           9,        45, nullptr},
-    { 71,         21237,     131339748,           3,       112, nullptr},
-    { 35,         12135,     131364020,           9,        79, nullptr},
-    { 60,       1240888,     131603703,           2,        81, nullptr},
-    { 33,       1780933,     131621906,           1,       116, nullptr},
-    { 69,       1231787,     131649212,           4,       102, nullptr},
-    { 35,         12135,     131655280,           9,       103, nullptr},
-    { 45,        473297,     131664382,           3,        70, nullptr},
-    { 52,        321599,     131964744,           3,        80, nullptr},
-    { 57,        136528,     132259038,           3,        85, nullptr},
-    { 64,        321599,     132541196,           3,        90, nullptr},
-    { 76,        312497,     132835490,           3,       110, nullptr},
-    { 75,        370142,     133108546,           3,       100, nullptr},
-    { 76,        342837,     133399806,           3,       106, nullptr},
-    { 75,        345871,     133688032,           3,       102, nullptr},
-    { 76,        342837,     133988394,           3,        94, nullptr},
-    { 71,        370142,     134267518,           3,        92, nullptr},
-    { 74,        282158,     134567880,           3,        85, nullptr},
-    { 72,         30339,     135144332,           4,       102, nullptr},
-    { 76,       1419892,     135147366,           4,       102, nullptr},
-    { 33,       1586760,     135150400,           1,       115, nullptr},
-    { 45,        452059,     135165570,           3,        61, nullptr},
-    { 42,         12135,     135441660,           9,        45, nullptr},
-    { 52,        324633,     135462898,           3,        70, nullptr},
-    { 42,         12135,     135732920,           9,        43, nullptr},
-    { 57,        136528,     135748090,           3,        82, nullptr},
-    { 60,        345871,     136018112,           3,       100, nullptr},
-    { 42,         12135,     136024180,           9,        44, nullptr},
-    { 64,        330701,     136303304,           3,       108, nullptr},
-    { 42,         12135,     136315440,           9,        45, nullptr},
-    { 69,         33373,     136579394,           3,       112, nullptr},
-    { 35,         12135,     136606700,           9,        81, nullptr},
-    { 59,       1771831,     136828179,           2,        78, nullptr},
-    { 28,       1604963,     136873688,           1,       118, nullptr},
-    { 40,        291259,     136885824,           3,        78, nullptr},
-    { 68,       1568556,     136891892,           4,       102, nullptr},
-    { 74,       1447198,     136894926,           4,       102, nullptr},
-    { 35,         12135,     136897960,           9,       103, nullptr},
-    { 42,         12135,     137189220,           9,        45, nullptr},
-    { 52,        330701,     137198322,           3,        83, nullptr},
-    { 42,         12135,     137480480,           9,        43, nullptr},
-    { 56,        130460,     137510820,           3,        90, nullptr},
-    { 37,         12135,     137771740,           9,        82, nullptr},
-    { 64,        330701,     137802080,           3,       108, nullptr},
-    { 42,         12135,     138063000,           9,        45, nullptr},
-    { 72,        336769,     138081204,           3,       108, nullptr},
-    { 42,         12135,     138354260,           9,        43, nullptr},
-    { 71,        273056,     138357294,           3,       100, nullptr},
-    { 57,       3767668,     138624282,           3,        75, nullptr},
-    { 45,       3840180,     138645520,           3,        55, nullptr},
-    { 72,       4283573,     138648554,           4,       102, nullptr},
-    { 60,       3696457,     138691029,           3,        85, nullptr},
-    { 64,       3579866,     138718335,           3,        57, nullptr},
-    { 69,       3545972,     138779014,           3,        89, nullptr},
+{//  note       duration        start  channelIdx     velocity  envelope
+    { 76,        345871,       3464780,           3,        95,       3},
+    { 75,        364075,       3783346,           3,        91,       3},
+    { 76,        354973,       4071572,           3,        94,       3},
+    { 75,        342837,       4350696,           3,       102,       3},
+    { 76,        342837,       4635888,           3,       102,       3},
+    { 71,        306429,       4936250,           3,        97,       3},
+    { 74,        330701,       5224476,           3,        93,       3},
+    { 72,        306429,       5518770,           3,        90,       3},
+    { 33,       1680812,       5825200,           1,       115,       1},
+    { 45,        761523,       5837335,           3,        90,       3},
+    { 52,        621961,       6146799,           3,        74,       3},
+    { 57,        251818,       6428957,           3,        76,       3},
+    { 60,        361041,       6702013,           3,        94,       3},
+    { 64,        339803,       6978104,           3,       102,       3},
+    { 69,         81916,       7232956,           3,       110,       3},
+    { 28,       1542786,       7539386,           1,       119,       1},
+    { 40,        283702,       7548488,           3,        79,       3},
+    { 74,       1494758,       7569726,           4,       102,       4},
+    { 52,        321339,       7843982,           3,        82,       3},
+    { 56,        168040,       8126997,           3,        89,       3},
+    { 64,        392093,       8410012,           3,       100,       3},
+    { 68,        336080,       8675339,           3,       106,       3},
+    { 71,        120870,       8943613,           3,       110,       3},
+    { 33,       1650397,       9238421,           1,       116,       1},
+    { 72,        680536,       9264953,           4,       102,       4},
+    { 69,       3136666,       9267901,           4,       102,       4},
+    { 45,        689242,       9276691,           3,        72,       3},
+    { 52,        432237,       9559981,           3,        75,       3},
+    { 57,        163549,       9866636,           3,        74,       3},
+    { 64,        306654,      10182052,           3,        84,       3},
+    { 76,        324177,      10450740,           3,        96,       3},
+    { 75,        350462,      10701905,           3,        90,       3},
+    { 51,         11682,      10766156,           5,        36,       5},
+    { 51,         11682,      10859613,           5,        41,       5},
+    { 51,         11682,      10944308,           5,        67,       5},
+    { 53,         11682,      10950149,           5,        27,       5},
+    { 76,        335859,      10988116,           3,        90,       3},
+    { 75,        327098,      11250963,           3,       102,       3},
+    { 76,        338780,      11522571,           3,       110,       3},
+    { 71,        373826,      11779577,           3,       108,       3},
+    { 74,        327098,      12068708,           3,        92,       3},
+    { 72,         46728,      12357840,           3,        76,       3},
+    { 76,       1483126,      12632369,           4,       102,       4},
+    { 33,       1555326,      12635290,           1,       115,       1},
+    { 69,        391349,      12673256,           3,        77,       3},
+    { 45,        641224,      12717064,           3,        56,       3},
+    { 52,        429795,      12991593,           3,        70,       3},
+    { 57,        186297,      13232087,           3,        79,       3},
+    { 60,        348555,      13502518,           3,        98,       3},
+    { 64,        345551,      13775954,           3,       108,       3},
+    { 69,        252402,      14031362,           3,       112,       3},
+    { 28,       1652163,      14325831,           1,       118,       1},
+    { 68,       1799879,      14346865,           4,       102,       4},
+    { 40,        275000,      14377995,           3,        78,       3},
+    { 52,        315625,      14674870,           3,        82,       3},
+    { 56,        178124,      14981120,           3,        80,       3},
+    { 64,        343750,      15287370,           3,        87,       3},
+    { 72,        334375,      15581120,           3,        96,       3},
+    { 71,        115624,      15852995,           3,        96,       3},
+    { 72,       3098316,      16146745,           4,       102,       4},
+    { 64,       3044597,      16149870,           4,       102,       4},
+    { 69,        669632,      16182607,           3,        92,       3},
+    { 45,        544634,      16203440,           3,        66,       3},
+    { 52,        398803,      16471293,           3,        75,       3},
+    { 57,        139878,      16768908,           3,        67,       3},
+    { 76,        288686,      17349256,           3,        86,       3},
+    { 75,        276781,      17640919,           3,        94,       3},
+    { 76,        288686,      17911748,           3,       114,       3},
+    { 75,        297614,      18167696,           3,       110,       3},
+    { 76,        267853,      18456383,           3,       108,       3},
+    { 71,        282733,      18709355,           3,       114,       3},
+    { 74,        321423,      19009946,           3,       100,       3},
+    { 33,       1731249,      19578389,           1,       115,       1},
+    { 69,        399999,      19587764,           3,        80,       3},
+    { 45,        625000,      19600264,           3,        73,       3},
+    { 42,         12499,      19878389,           5,        45,       5},
+    { 52,        365625,      19906514,           3,        56,       3},
+    { 42,         12499,      20178389,           5,        43,       5},
+    { 57,        162500,      20194014,           3,        80,       3},
+    { 81,         12499,      20478389,           5,        34,       5},
+    { 60,        337500,      20487764,           3,        87,       3},
+    { 42,         12500,      20778389,           5,        45,       5},
+    { 64,        315624,      20784639,           3,        90,       3},
+    { 69,         87499,      21065889,           3,       100,       3},
+    { 35,         12499,      21078389,           5,        81,       5},
+    { 28,       1634375,      21344014,           1,       116,       1},
+    { 74,       1565625,      21375264,           4,       102,       4},
+    { 35,         12500,      21378389,           5,       103,       5},
+    { 40,        268750,      21384639,           3,        74,       3},
+    { 52,        296875,      21675264,           3,        84,       3},
+    { 42,         12499,      21678389,           5,        45,       5},
+    { 56,        153125,      21965889,           3,        96,       3},
+    { 42,         12499,      21978389,           5,        43,       5},
+    { 64,        393749,      22250264,           3,       108,       3},
+    { 81,         12499,      22278389,           5,        34,       5},
+    { 68,        346875,      22537764,           3,       110,       3},
+    { 42,         12499,      22578389,           5,        45,       5},
+    { 71,        118750,      22822139,           3,       110,       3},
+    { 35,         12500,      22878389,           5,        79,       5},
+    { 33,       1799065,      23144014,           1,       116,       1},
+    { 72,        542397,      23172139,           4,       102,       4},
+    { 69,       1819897,      23175264,           4,       102,       4},
+    { 46,         12254,      23178389,           5,        45,       5},
+    { 45,        603548,      23181453,           3,        58,       3},
+    { 52,        389089,      23484759,           3,        70,       3},
+    { 57,        125611,      23809511,           3,        72,       3},
+    { 64,        287987,      24100563,           3,        86,       3},
+    { 76,        333943,      24379359,           3,        96,       3},
+    { 75,        355388,      24664283,           3,        86,       3},
+    { 76,        349261,      24952271,           3,        84,       3},
+    { 75,        321688,      25243322,           3,        84,       3},
+    { 76,        404408,      25525182,           3,        92,       3},
+    { 71,        367643,      25816233,           3,        96,       3},
+    { 74,        337006,      26107285,           3,        90,       3},
+    { 72,         24509,      26404463,           3,        82,       3},
+    { 72,         55146,      26704706,           4,       102,       4},
+    { 33,       1602314,      26707770,           1,       115,       1},
+    { 69,        346197,      26723088,           3,        82,       3},
+    { 45,        530019,      26747598,           3,        59,       3},
+    { 42,         12254,      27001885,           5,        45,       5},
+    { 52,        309433,      27050904,           3,        54,       3},
+    { 42,         12254,      27296000,           5,        43,       5},
+    { 57,        143993,      27317445,           3,        83,       3},
+    { 37,         12254,      27590115,           5,        82,       5},
+    { 60,        306369,      27602369,           3,        94,       3},
+    { 64,        346197,      27884230,           3,       100,       3},
+    { 69,         61273,      28166090,           3,       114,       3},
+    { 35,         12254,      28178345,           5,        81,       5},
+    { 28,       1620696,      28447950,           1,       118,       1},
+    { 68,       1639078,      28469396,           4,       102,       4},
+    { 42,         12254,      28472459,           5,        53,       5},
+    { 40,        266541,      28478587,           3,        75,       3},
+    { 42,         12254,      28766574,           5,        45,       5},
+    { 52,        291051,      28772702,           3,        84,       3},
+    { 42,         12254,      29060689,           5,        43,       5},
+    { 56,        134802,      29063753,           3,        84,       3},
+    { 42,         12254,      29354804,           5,        44,       5},
+    { 64,        379898,      29357868,           3,       104,       3},
+    { 42,         12254,      29648919,           5,        45,       5},
+    { 72,        346197,      29651983,           3,       110,       3},
+    { 71,        110293,      29936907,           3,       108,       3},
+    { 42,         12254,      29943034,           5,        43,       5},
+    { 60,        951754,      30154430,           2,        87,       2},
+    { 72,        800583,      30237149,           4,       102,       4},
+    { 69,        380946,      30243102,           3,        92,       3},
+    { 45,        571419,      30249054,           3,        73,       3},
+    { 42,         11904,      30522859,           5,        45,       5},
+    { 52,        333328,      30537740,           3,        80,       3},
+    { 42,         11904,      30808569,           5,        43,       5},
+    { 57,        172616,      30832379,           3,        84,       3},
+    { 55,        877963,      31094279,           2,        69,       2},
+    { 67,        654752,      31097256,           4,       102,       4},
+    { 62,        639871,      31100232,           2,        86,       2},
+    { 81,         11904,      31109160,           5,        25,       5},
+    { 71,        363089,      31112136,           3,       112,       3},
+    { 42,         11904,      31379989,           5,        45,       5},
+    { 81,         11904,      31385942,           5,        28,       5},
+    { 72,        354161,      31394870,           3,       114,       3},
+    { 81,         11904,      31662723,           5,        35,       5},
+    { 42,         11904,      31665699,           5,        43,       5},
+    { 74,        363089,      31668676,           3,       125,       3},
+    { 36,       1485096,      31945457,           1,       124,       1},
+    { 72,       1401764,      31948433,           4,       102,       4},
+    { 35,         11904,      31951409,           5,       103,       5},
+    { 76,        407731,      31963314,           3,       106,       3},
+    { 48,        526777,      31990099,           3,        79,       3},
+    { 42,         11904,      32237119,           5,        45,       5},
+    { 55,        374994,      32252000,           3,        90,       3},
+    { 42,         11904,      32522829,           5,        43,       5},
+    { 60,        154759,      32531758,           3,        87,       3},
+    { 37,         11904,      32808539,           5,        82,       5},
+    { 67,        386898,      32820444,           3,       110,       3},
+    { 42,         11904,      33094249,           5,        45,       5},
+    { 77,        372018,      33103178,           3,       123,       3},
+    { 76,        374994,      33374007,           3,       116,       3},
+    { 35,         11904,      33379959,           5,        79,       5},
+    { 62,       1458311,      33662693,           4,       102,       4},
+    { 35,         11904,      33665670,           5,       103,       5},
+    { 31,        702370,      33668646,           1,       120,       1},
+    { 71,       1267838,      33671622,           2,        86,       2},
+    { 43,        249996,      33680550,           3,        84,       3},
+    { 74,        366065,      33701383,           2,        76,       2},
+    { 42,         11904,      33951380,           5,        45,       5},
+    { 55,        294638,      33957332,           3,        92,       3},
+    { 42,         11904,      34237090,           5,        43,       5},
+    { 59,        178568,      34240066,           3,        98,       3},
+    { 56,        877963,      34493038,           2,        85,       2},
+    { 68,        571420,      34522800,           4,       102,       4},
+    { 32,        705346,      34525776,           1,       123,       1},
+    { 42,         11904,      34808510,           5,        45,       5},
+    { 76,        357137,      34811486,           3,       120,       3},
+    { 74,        333328,      35085291,           3,       108,       3},
+    { 35,         11904,      35094220,           5,        81,       5},
+    { 69,       1309504,      35376953,           4,       102,       4},
+    { 42,         11904,      35379930,           5,        53,       5},
+    { 72,        485111,      35382906,           3,       102,       3},
+    { 33,       1178553,      35388858,           1,       120,       1},
+    { 45,        595229,      35400763,           3,        74,       3},
+    { 42,         11904,      35665640,           5,        45,       5},
+    { 52,        410708,      35677544,           3,        78,       3},
+    { 42,         11904,      35951350,           5,        43,       5},
+    { 57,        151783,      35972183,           3,        78,       3},
+    { 42,         11904,      36237060,           5,        44,       5},
+    { 64,        380946,      36257893,           3,        84,       3},
+    { 42,         11904,      36522770,           5,        45,       5},
+    { 74,        333328,      36561459,           3,        90,       3},
+    { 42,         11904,      36808480,           5,        43,       5},
+    { 33,        285710,      36820384,           1,       123,       1},
+    { 72,        154759,      36826336,           3,        94,       3},
+    { 68,       1705331,      37094190,           4,       102,       4},
+    { 28,       3463547,      37103118,           1,       121,       1},
+    { 71,        416660,      37135856,           3,        98,       3},
+    { 40,        241067,      37150736,           3,        80,       3},
+    { 52,         53570,      37427518,           3,        83,       3},
+    { 64,         50594,      37710252,           3,        83,       3},
+    { 64,        247020,      37972153,           3,       102,       3},
+    { 76,        116069,      38257863,           3,       114,       3},
+    { 64,        226187,      38537620,           3,        92,       3},
+    { 76,         89284,      38823330,           3,        89,       3},
+    { 76,        285710,      39100112,           3,       116,       3},
+    { 88,         80355,      39409631,           3,       102,       3},
+    { 75,        276090,      39680749,           3,        82,       3},
+    { 76,        133494,      39962907,           3,        92,       3},
+    { 75,        324633,      40251133,           3,        92,       3},
+    { 76,        339803,      40542393,           2,        76,       2},
+    { 75,        330701,      40821518,           2,        84,       2},
+    { 76,        309463,      41106710,           3,       106,       3},
+    { 71,        294293,      41394936,           3,       110,       3},
+    { 74,        339803,      41695298,           3,       102,       3},
+    { 33,       1680812,      42286920,           1,       115,       1},
+    { 69,        348905,      42314225,           3,        85,       3},
+    { 45,        716014,      42347599,           3,        66,       3},
+    { 42,         12135,      42578180,           5,        45,       5},
+    { 52,        452059,      42617621,           3,        70,       3},
+    { 42,         12135,      42869440,           5,        43,       5},
+    { 57,        182037,      42908881,           3,        75,       3},
+    { 81,         12135,      43160700,           5,        34,       5},
+    { 60,        364074,      43191039,           3,        94,       3},
+    { 42,         12135,      43451960,           5,        45,       5},
+    { 64,        330701,      43476231,           3,       100,       3},
+    { 69,         97086,      43740186,           3,       106,       3},
+    { 42,         12135,      43743220,           5,        43,       5},
+    { 28,       1586760,      44001106,           1,       116,       1},
+    { 74,       1435062,      44034480,           4,       102,       4},
+    { 40,        294293,      44040547,           3,        82,       3},
+    { 42,         12135,      44325740,           5,        45,       5},
+    { 52,        321599,      44331807,           3,        86,       3},
+    { 42,         12135,      44617000,           5,        43,       5},
+    { 56,        133494,      44620033,           3,        96,       3},
+    { 64,        382278,      44893090,           3,       108,       3},
+    { 42,         12135,      44908260,           5,        44,       5},
+    { 68,        324633,      45175248,           3,       106,       3},
+    { 42,         12135,      45199520,           5,        45,       5},
+    { 71,          9101,      45451338,           3,       110,       3},
+    { 35,         12135,      45490780,           5,        79,       5},
+    { 33,       1731463,      45748666,           1,       116,       1},
+    { 69,       1300186,      45779006,           4,       102,       4},
+    { 45,        790083,      45782040,           3,        74,       3},
+    { 52,        586666,      46056210,           3,        83,       3},
+    { 57,        283015,      46342173,           3,        74,       3},
+    { 64,        406834,      46625188,           3,        85,       3},
+    { 76,        336080,      46928840,           3,        98,       3},
+    { 75,        353768,      47194166,           3,        90,       3},
+    { 76,        327236,      47483078,           3,        94,       3},
+    { 75,        336080,      47751352,           3,       108,       3},
+    { 76,        344924,      48031419,           3,       106,       3},
+    { 71,        359664,      48305590,           3,       104,       3},
+    { 74,        321339,      48591553,           3,        96,       3},
+    { 72,         32428,      48856880,           3,        84,       3},
+    { 45,       1155644,      49160531,           3,        82,       3},
+    { 69,        849044,      49175271,           4,       102,       4},
+    { 33,       1541842,      49178220,           1,       115,       1},
+    { 52,        854941,      49461235,           3,        79,       3},
+    { 57,        521808,      49738353,           3,        79,       3},
+    { 42,         11792,      49744250,           5,        43,       5},
+    { 60,        412730,      50003680,           3,        87,       3},
+    { 81,         11792,      50027265,           5,        34,       5},
+    { 64,        297755,      50289643,           3,       110,       3},
+    { 42,         11792,      50310280,           5,        45,       5},
+    { 69,         73701,      50528437,           3,       106,       3},
+    { 42,         11792,      50593295,           5,        43,       5},
+    { 40,        227001,      50840933,           3,        80,       3},
+    { 28,       1559530,      50852725,           1,       118,       1},
+    { 68,       1506465,      50873361,           4,       102,       4},
+    { 42,         11792,      50876310,           5,        53,       5},
+    { 52,        344924,      51126896,           3,        87,       3},
+    { 42,         11792,      51159325,           5,        45,       5},
+    { 42,         11792,      51442340,           5,        43,       5},
+    { 56,        144455,      51445288,           3,        47,       3},
+    { 64,        359664,      51707666,           3,        94,       3},
+    { 81,         11792,      51725355,           5,        34,       5},
+    { 72,        333132,      51972993,           3,       112,       3},
+    { 42,         11792,      52008370,           5,        45,       5},
+    { 71,         82546,      52250111,           3,       106,       3},
+    { 35,         11792,      52291385,           5,        79,       5},
+    { 60,        940435,      52494802,           2,        87,       2},
+    { 45,        704589,      52562607,           3,        79,       3},
+    { 72,        884421,      52571451,           4,       102,       4},
+    { 33,        787135,      52574400,           1,       118,       1},
+    { 52,        536549,      52854466,           3,        75,       3},
+    { 42,         11792,      52857414,           5,        45,       5},
+    { 42,         11792,      53140429,           5,        43,       5},
+    { 57,        197520,      53155170,           3,        78,       3},
+    { 55,        869681,      53423444,           2,        69,       2},
+    { 67,        589614,      53429341,           4,       102,       4},
+    { 81,         11792,      53438185,           5,        25,       5},
+    { 42,         11792,      53706459,           5,        45,       5},
+    { 72,        339028,      53712356,           3,       127,       3},
+    { 81,         11792,      53986526,           5,        35,       5},
+    { 42,         11792,      53989474,           5,        43,       5},
+    { 74,        356716,      53992423,           3,       127,       3},
+    { 36,       1471088,      54266593,           1,       124,       1},
+    { 72,       1506465,      54269541,           4,       102,       4},
+    { 35,         11792,      54272489,           5,       103,       5},
+    { 76,        893266,      54278386,           3,       114,       3},
+    { 48,        542445,      54290178,           3,        83,       3},
+    { 42,         11792,      54555504,           5,        45,       5},
+    { 55,        374405,      54570245,           3,        92,       3},
+    { 42,         11792,      54838519,           5,        43,       5},
+    { 60,        156247,      54847364,           3,        98,       3},
+    { 81,         11792,      55121534,           5,        34,       5},
+    { 67,        386197,      55127431,           3,       110,       3},
+    { 42,         11792,      55404549,           5,        45,       5},
+    { 77,        330184,      55410446,           3,       114,       3},
+    { 76,        374405,      55678720,           3,       118,       3},
+    { 35,         11792,      55687564,           5,        79,       5},
+    { 62,       1456348,      55967631,           4,       102,       4},
+    { 42,         11792,      55970579,           5,        53,       5},
+    { 31,        695745,      55973528,           1,       120,       1},
+    { 71,       1382646,      55976476,           2,        86,       2},
+    { 43,        262378,      56003008,           3,        81,       3},
+    { 74,        409782,      56005956,           2,        76,       2},
+    { 42,         11792,      56253594,           5,        45,       5},
+    { 55,        265326,      56268335,           3,        84,       3},
+    { 42,         11792,      56536609,           5,        43,       5},
+    { 59,         94338,      56586727,           3,        59,       3},
+    { 56,        869681,      56790144,           2,        85,       2},
+    { 68,        769447,      56816676,           2,        83,       2},
+    { 37,         11792,      56819624,           5,        82,       5},
+    { 32,        698693,      56822573,           1,       123,       1},
+    { 65,        321339,      56837313,           3,        90,       3},
+    { 42,         11792,      57102639,           5,        45,       5},
+    { 76,        288911,      57123276,           3,        90,       3},
+    { 42,         11792,      57385654,           5,        43,       5},
+    { 74,        315443,      57391551,           3,        94,       3},
+    { 69,       1370853,      57668669,           4,       102,       4},
+    { 72,        477587,      57671618,           3,        87,       3},
+    { 33,       1167436,      57677514,           1,       120,       1},
+    { 45,        571926,      57704046,           3,        60,       3},
+    { 42,         11792,      57951684,           5,        45,       5},
+    { 52,        389145,      57963477,           3,        84,       3},
+    { 42,         11792,      58234699,           5,        43,       5},
+    { 57,        132663,      58249440,           3,        82,       3},
+    { 37,         11792,      58517714,           5,        82,       5},
+    { 64,        227001,      58538351,           3,        82,       3},
+    { 42,         11792,      58800729,           5,        45,       5},
+    { 74,        274170,      58839054,           3,        88,       3},
+    { 35,         11792,      59083744,           5,        79,       5},
+    { 33,        283014,      59095537,           1,       123,       1},
+    { 72,        156247,      59098485,           3,       104,       3},
+    { 68,       1689245,      59366759,           4,       102,       4},
+    { 28,       3414909,      59375604,           1,       121,       1},
+    { 71,        324288,      59384448,           3,        92,       3},
+    { 52,        132663,      59649774,           3,        92,       3},
+    { 64,         76649,      59932789,           3,        85,       3},
+    { 64,        259430,      60215804,           3,       110,       3},
+    { 76,        120870,      60528300,           3,       120,       3},
+    { 64,        224053,      60802471,           3,       108,       3},
+    { 76,         91390,      61067798,           3,       120,       3},
+    { 76,        339028,      61341968,           3,       125,       3},
+    { 88,        103182,      61633828,           3,       115,       3},
+    { 75,        300703,      61905050,           3,       106,       3},
+    { 76,        129715,      62185117,           3,       104,       3},
+    { 75,        304114,      62471080,           3,       114,       3},
+    { 76,        308855,      62748199,           3,       106,       3},
+    { 75,        376834,      63081564,           3,        96,       3},
+    { 76,        376834,      63378743,           3,        92,       3},
+    { 71,         39828,      63663667,           3,        90,       3},
+    { 74,        321688,      63957782,           3,        92,       3},
+    { 33,       1697288,      64527629,           1,       115,       1},
+    { 76,       1473638,      64530693,           4,       102,       4},
+    { 69,        349261,      64552139,           3,        84,       3},
+    { 45,        511637,      64567458,           3,        69,       3},
+    { 42,         12254,      64821744,           5,        45,       5},
+    { 52,        275732,      64852381,           3,        69,       3},
+    { 42,         12254,      65115859,           5,        43,       5},
+    { 57,        147057,      65140369,           3,        81,       3},
+    { 81,         12254,      65409974,           5,        34,       5},
+    { 60,        343134,      65434484,           3,        90,       3},
+    { 42,         12254,      65704089,           5,        45,       5},
+    { 64,        343134,      65722472,           3,        94,       3},
+    { 35,         12254,      65998204,           5,        81,       5},
+    { 69,        107229,      66004332,           3,       110,       3},
+    { 28,       1602314,      66258619,           1,       116,       1},
+    { 74,       1583931,      66289256,           4,       102,       4},
+    { 42,         12254,      66292319,           5,        53,       5},
+    { 83,       1715670,      66307638,           2,        92,       2},
+    { 71,        404408,      66313765,           2,        93,       2},
+    { 40,        266541,      66344402,           3,        70,       3},
+    { 42,         12254,      66586434,           5,        45,       5},
+    { 52,        278796,      66607880,           3,        87,       3},
+    { 42,         12254,      66880549,           5,        43,       5},
+    { 56,        131739,      66895868,           3,        89,       3},
+    { 81,         12254,      67174664,           5,        34,       5},
+    { 64,        398280,      67180792,           3,       102,       3},
+    { 68,        355388,      67459588,           3,       110,       3},
+    { 42,         12254,      67468779,           5,        45,       5},
+    { 71,        125611,      67747576,           3,       110,       3},
+    { 42,         12254,      67762894,           5,        43,       5},
+    { 84,       1093821,      68001863,           2,        84,       2},
+    { 33,       1747960,      68023309,           1,       116,       1},
+    { 69,       3011947,      68053946,           4,       102,       4},
+    { 46,         11904,      68057009,           5,        45,       5},
+    { 45,        550586,      68077843,           3,        78,       3},
+    { 52,        389875,      68360576,           3,        80,       3},
+    { 57,        166664,      68676048,           3,        72,       3},
+    { 64,        133926,      68952829,           3,        90,       3},
+    { 76,        315471,      69244492,           3,       106,       3},
+    { 75,        345232,      69503416,           3,       106,       3},
+    { 76,        318447,      69789126,           3,        94,       3},
+    { 75,        327376,      70062932,           3,       116,       3},
+    { 76,        372018,      70342689,           3,       102,       3},
+    { 47,        333328,      70583757,           2,        96,       2},
+    { 59,        363089,      70586733,           2,        96,       2},
+    { 71,        357137,      70619471,           3,       108,       3},
+    { 50,        294638,      70893276,           2,       100,       2},
+    { 62,        333328,      70905181,           2,       100,       2},
+    { 48,        336304,      71149225,           2,        97,       2},
+    { 60,        300590,      71176010,           2,       106,       2},
+    { 76,       1410693,      71482553,           4,       102,       4},
+    { 33,       1556524,      71485529,           1,       115,       1},
+    { 45,        595229,      71494458,           3,        74,       3},
+    { 42,         11904,      71771239,           5,        45,       5},
+    { 52,        339280,      71780168,           3,        76,       3},
+    { 57,        119045,      72050997,           3,        86,       3},
+    { 42,         11904,      72056949,           5,        43,       5},
+    { 60,        321423,      72327779,           3,       106,       3},
+    { 42,         11904,      72342659,           5,        44,       5},
+    { 64,        330352,      72610513,           3,       106,       3},
+    { 42,         11904,      72628369,           5,        45,       5},
+    { 69,         68451,      72890270,           3,       112,       3},
+    { 42,         11904,      72914080,           5,        43,       5},
+    { 28,       1574381,      73175980,           1,       118,       1},
+    { 83,       1779735,      73184909,           2,        81,       2},
+    { 40,        261900,      73190861,           2,        92,       2},
+    { 74,       1657713,      73196813,           4,       102,       4},
+    { 71,        330352,      73199790,           4,       102,       4},
+    { 52,        205354,      73476571,           3,        83,       3},
+    { 42,         11904,      73485500,           5,        45,       5},
+    { 42,         11904,      73771210,           5,        43,       5},
+    { 56,        127974,      73777162,           3,        76,       3},
+    { 37,         11904,      74056920,           5,        82,       5},
+    { 64,        303566,      74068824,           3,        92,       3},
+    { 42,         11904,      74342630,           5,        45,       5},
+    { 72,        336304,      74354534,           3,        96,       3},
+    { 35,         11904,      74628340,           5,        79,       5},
+    { 71,         56546,      74634292,           3,        92,       3},
+    { 81,        860106,      74884288,           2,        86,       2},
+    { 33,        794630,      74914050,           1,       118,       1},
+    { 69,        386898,      74922978,           3,        96,       3},
+    { 45,        407731,      74937859,           3,        76,       3},
+    { 42,         11904,      75199760,           5,        45,       5},
+    { 52,        249996,      75211664,           3,        78,       3},
+    { 42,         11904,      75485470,           5,        43,       5},
+    { 57,         50594,      75494398,           3,        83,       3},
+    { 46,         11904,      75771180,           5,        34,       5},
+    { 34,        175592,      75783084,           1,       126,       1},
+    { 81,         11904,      75786060,           5,        25,       5},
+    { 64,        101188,      75797965,           4,       102,       4},
+    { 72,        113093,      75806893,           4,       102,       4},
+    { 58,         32737,      75824750,           2,       121,       2},
+    { 70,        288686,      75839631,           2,       121,       2},
+    { 45,         11904,      76056890,           5,        45,       5},
+    { 81,         11904,      76062842,           5,        28,       5},
+    { 72,        110117,      76068794,           3,       127,       3},
+    { 33,        181544,      76071770,           1,       121,       1},
+    { 65,         89284,      76077723,           3,       110,       3},
+    { 57,         56546,      76098556,           2,       123,       2},
+    { 69,        279757,      76125341,           2,       122,       2},
+    { 81,         11904,      76339623,           5,        35,       5},
+    { 41,         11904,      76342600,           5,        43,       5},
+    { 31,        208330,      76354504,           1,       123,       1},
+    { 55,         68451,      76360456,           3,       110,       3},
+    { 67,         17856,      76363433,           2,       119,       2},
+    { 35,         11904,      76628310,           5,       103,       5},
+    { 69,        157735,      76631286,           3,       114,       3},
+    { 72,       1217243,      76637238,           3,       118,       3},
+    { 29,       1142840,      76640214,           1,       123,       1},
+    { 53,       1336289,      76643190,           3,        84,       3},
+    { 42,         11904,      76914020,           5,        45,       5},
+    { 57,        279757,      76928900,           3,        78,       3},
+    { 42,         11904,      77199730,           5,        43,       5},
+    { 60,        306543,      77232467,           3,        79,       3},
+    { 40,         11904,      77485440,           5,        78,       5},
+    { 57,        247020,      77512225,           3,        75,       3},
+    { 42,         11904,      77771150,           5,        45,       5},
+    { 60,        116069,      77786030,           3,        79,       3},
+    { 77,        372018,      77789006,           3,       123,       3},
+    { 57,        309519,      78053883,           3,        83,       3},
+    { 35,         11904,      78056860,           5,        79,       5},
+    { 29,        300590,      78059836,           1,       120,       1},
+    { 76,         95236,      78089597,           3,       118,       3},
+    { 65,       1354146,      78342570,           4,       102,       4},
+    { 53,       1476168,      78345546,           3,        79,       3},
+    { 76,        562491,      78351498,           3,       125,       3},
+    { 34,       1163673,      78360426,           1,       120,       1},
+    { 42,         11904,      78628280,           5,        45,       5},
+    { 58,        285709,      78631256,           3,        78,       3},
+    { 62,        288686,      78911013,           3,        70,       3},
+    { 42,         11904,      78913990,           5,        43,       5},
+    { 74,        196425,      78919942,           3,       104,       3},
+    { 58,        294638,      79193747,           3,        66,       3},
+    { 42,         11904,      79199700,           5,        44,       5},
+    { 42,         11904,      79485410,           5,        45,       5},
+    { 62,        386898,      79491362,           3,        69,       3},
+    { 82,        354161,      79494338,           3,       120,       3},
+    { 58,        389875,      79768143,           3,        73,       3},
+    { 42,         11904,      79771120,           5,        43,       5},
+    { 81,         92260,      79848499,           3,       112,       3},
+    { 29,       1235100,      80044925,           1,       115,       1},
+    { 65,       1485096,      80053853,           4,       102,       4},
+    { 42,         11904,      80056830,           5,        53,       5},
+    { 53,        318447,      80059806,           3,        80,       3},
+    { 81,        369042,      80062782,           3,       118,       3},
+    { 79,        363089,      80342540,           3,       112,       3},
+    { 64,        419636,      80345516,           3,        78,       3},
+    { 42,         11904,      80628250,           5,        43,       5},
+    { 77,        291662,      80631226,           3,       104,       3},
+    { 58,        276781,      80643130,           3,        73,       3},
+    { 76,        333328,      80905031,           3,       100,       3},
+    { 42,         11904,      80913960,           5,        44,       5},
+    { 64,        372018,      80916936,           3,        86,       3},
+    { 74,        264876,      81190741,           3,        96,       3},
+    { 42,         11904,      81199670,           5,        45,       5},
+    { 58,        270829,      81217526,           3,        73,       3},
+    { 53,        199401,      81226455,           3,        70,       3},
+    { 55,        193449,      81229431,           3,        75,       3},
+    { 72,         47618,      81467523,           3,        90,       3},
+    { 29,        223210,      81470499,           1,       124,       1},
+    { 35,         11904,      81485380,           5,        79,       5},
+    { 64,        339280,      81491332,           3,        72,       3},
+    { 70,        675585,      81762161,           3,        90,       3},
+    { 72,          2976,      81768113,           4,       102,       4},
+    { 65,       1482120,      81771090,           2,        96,       2},
+    { 29,       1255933,      81774066,           1,       122,       1},
+    { 53,       1377955,      81777042,           3,        71,       3},
+    { 42,         11904,      82056800,           5,        37,       5},
+    { 57,        315471,      82065728,           3,        73,       3},
+    { 42,         11904,      82342510,           5,        43,       5},
+    { 69,        104165,      82351438,           3,        87,       3},
+    { 60,        270829,      82363343,           3,        73,       3},
+    { 40,         11904,      82628220,           5,        78,       5},
+    { 57,        315471,      82634172,           3,        77,       3},
+    { 70,        160711,      82785955,           3,        90,       3},
+    { 42,         11904,      82913930,           5,        45,       5},
+    { 69,        157735,      82916906,           3,        94,       3},
+    { 60,        321423,      82943691,           3,        85,       3},
+    { 67,        214282,      83068689,           3,       110,       3},
+    { 29,        226187,      83175830,           1,       122,       1},
+    { 42,         11904,      83199640,           5,        43,       5},
+    { 69,             0,      83217496,           3,       106,       3},
+    { 57,        279757,      83229401,           3,        74,       3},
+    { 70,        193449,      83357375,           3,       102,       3},
+    { 41,       1318432,      83473445,           1,       114,       1},
+    { 65,       1318432,      83482373,           4,       102,       4},
+    { 35,         11904,      83485350,           5,       103,       5},
+    { 72,       1238076,      83500230,           3,       108,       3},
+    { 53,       1401764,      83512135,           3,        78,       3},
+    { 42,         11904,      83771060,           5,        45,       5},
+    { 57,        247020,      83830582,           3,        73,       3},
+    { 42,         11904,      84056770,           5,        43,       5},
+    { 60,        330352,      84092483,           3,        83,       3},
+    { 40,         11904,      84342480,           5,        78,       5},
+    { 57,        291662,      84366289,           3,        83,       3},
+    { 42,         11904,      84628190,           5,        45,       5},
+    { 60,        339280,      84646046,           3,        79,       3},
+    { 75,        380946,      84901995,           3,       114,       3},
+    { 35,         11904,      84913900,           5,        81,       5},
+    { 57,        315471,      84931756,           3,        73,       3},
+    { 69,        758917,      85196633,           4,       102,       4},
+    { 35,         11904,      85199610,           5,       103,       5},
+    { 76,        565467,      85202586,           3,       108,       3},
+    { 40,        782726,      85208538,           1,       114,       1},
+    { 52,        791654,      85217466,           3,        79,       3},
+    { 42,         11904,      85485320,           5,        45,       5},
+    { 57,        282733,      85503176,           3,        90,       3},
+    { 42,         11904,      85771030,           5,        43,       5},
+    { 60,        291662,      85776982,           3,        94,       3},
+    { 76,        354161,      86035906,           3,       123,       3},
+    { 57,        249996,      86047811,           3,        88,       3},
+    { 65,        571420,      86056740,           4,       102,       4},
+    { 74,        580348,      86062692,           2,       106,       2},
+    { 38,        630942,      86077573,           1,       111,       1},
+    { 77,        392851,      86339473,           3,       106,       3},
+    { 42,         11904,      86342450,           5,        45,       5},
+    { 62,        360113,      86345426,           3,        84,       3},
+    { 50,        321423,      86351378,           3,        75,       3},
+    { 35,         11904,      86628160,           5,        79,       5},
+    { 69,         89284,      86631136,           3,       114,       3},
+    { 57,         89284,      86640064,           3,        96,       3},
+    { 36,        741060,      86896013,           1,       109,       1},
+    { 42,         11904,      86913870,           5,        53,       5},
+    { 67,        598205,      86928750,           2,       121,       2},
+    { 55,        294638,      86940655,           3,        85,       3},
+    { 42,         11904,      87199580,           5,        45,       5},
+    { 64,        303566,      87208508,           3,        87,       3},
+    { 74,        172616,      87485290,           3,       108,       3},
+    { 55,        205354,      87491242,           3,        90,       3},
+    { 72,        142854,      87634097,           3,       108,       3},
+    { 31,        684513,      87762071,           1,       123,       1},
+    { 64,        306543,      87765047,           3,        70,       3},
+    { 40,         11904,      87771000,           5,        78,       5},
+    { 67,        562491,      87779928,           2,       109,       2},
+    { 62,        553563,      87791833,           2,       119,       2},
+    { 71,        145831,      87794809,           2,       118,       2},
+    { 72,        172616,      87887069,           3,       106,       3},
+    { 74,        130950,      88029924,           3,       110,       3},
+    { 42,         11904,      88056710,           5,        45,       5},
+    { 55,        199401,      88062662,           3,        88,       3},
+    { 65,         80355,      88333491,           3,        90,       3},
+    { 35,         11904,      88342420,           5,        79,       5},
+    { 71,        119045,      88384086,           3,        96,       3},
+    { 36,        494040,      88613249,           1,       125,       1},
+    { 60,        107141,      88628130,           3,        84,       3},
+    { 64,         86308,      88634082,           3,        90,       3},
+    { 72,        160711,      88637058,           3,       114,       3},
+    { 79,        148807,      88770985,           3,       118,       3},
+    { 67,        119045,      88919792,           3,       106,       3},
+    { 79,        133926,      89062647,           3,       114,       3},
+    { 42,         11904,      89199550,           5,        43,       5},
+    { 69,        113093,      89214430,           3,        94,       3},
+    { 79,        116069,      89351333,           3,       102,       3},
+    { 41,        199401,      89470379,           1,       124,       1},
+    { 67,          5952,      89479307,           4,       102,       4},
+    { 40,         11904,      89485260,           5,        78,       5},
+    { 67,         56546,      89491212,           3,        82,       3},
+    { 71,        110117,      89494188,           3,       100,       3},
+    { 65,         32737,      89509069,           3,        61,       3},
+    { 79,        104165,      89637043,           3,        89,       3},
+    { 40,        172616,      89770970,           1,       124,       1},
+    { 67,         77379,      89785850,           3,        90,       3},
+    { 79,        127974,      89904896,           3,        92,       3},
+    { 35,         11904,      90056680,           5,        81,       5},
+    { 38,        133926,      90062632,           1,       121,       1},
+    { 79,        139878,      90175725,           3,        92,       3},
+    { 76,        199401,      90330485,           3,       114,       3},
+    { 62,        229163,      90342390,           4,       102,       4},
+    { 64,         74403,      90345366,           3,        94,       3},
+    { 36,        425588,      90348342,           1,       126,       1},
+    { 79,        157735,      90485245,           3,       106,       3},
+    { 84,        196425,      90610243,           3,       114,       3},
+    { 42,         11904,      90628100,           5,        45,       5},
+    { 83,        184521,      90759050,           3,       123,       3},
+    { 72,         53570,      90770955,           2,       102,       2},
+    { 81,        211222,      90895953,           3,       120,       3},
+    { 69,        488228,      90907857,           4,       102,       4},
+    { 35,         11904,      90913810,           5,        80,       5},
+    { 57,        635520,      90919762,           3,        94,       3},
+    { 79,        124184,      91059641,           3,       108,       3},
+    { 77,        162144,      91195617,           3,       110,       3},
+    { 42,         11792,      91198565,           5,        44,       5},
+    { 76,        206365,      91322384,           3,       110,       3},
+    { 67,        386197,      91478632,           4,       102,       4},
+    { 35,         11792,      91481580,           5,        79,       5},
+    { 31,        409782,      91484528,           1,       124,       1},
+    { 74,        162144,      91493372,           3,        92,       3},
+    { 59,        409782,      91499268,           3,        65,       3},
+    { 55,        383249,      91514009,           3,        67,       3},
+    { 79,        179832,      91643724,           3,        98,       3},
+    { 42,         11792,      91764595,           5,        43,       5},
+    { 77,        156247,      91805868,           3,        84,       3},
+    { 74,         73701,      91923791,           3,        87,       3},
+    { 64,        680316,      92035818,           2,       105,       2},
+    { 35,         11792,      92047610,           5,        79,       5},
+    { 33,        633449,      92050558,           1,       126,       1},
+    { 52,        779338,      92065298,           3,        79,       3},
+    { 42,         11682,      92330625,           5,        37,       5},
+    { 57,        277449,      92348148,           3,        90,       3},
+    { 42,         11682,      92610995,           5,        43,       5},
+    { 60,        286211,      92616836,           3,        94,       3},
+    { 65,        858633,      92844637,           2,       106,       2},
+    { 76,        347541,      92870921,           3,       123,       3},
+    { 38,        686322,      92873842,           1,       124,       1},
+    { 57,        245323,      92882603,           3,        88,       3},
+    { 74,        525693,      92888445,           4,       102,       4},
+    { 40,         11682,      92891365,           5,        78,       5},
+    { 77,        242403,      93168815,           3,       106,       3},
+    { 42,         11682,      93171735,           5,        45,       5},
+    { 62,        344621,      93174656,           3,        84,       3},
+    { 50,        315416,      93180497,           3,        75,       3},
+    { 35,         11682,      93452105,           5,        79,       5},
+    { 69,        183992,      93455026,           3,       114,       3},
+    { 57,         87615,      93463787,           3,        96,       3},
+    { 36,        753494,      93729555,           1,       123,       1},
+    { 42,         11682,      93732475,           5,        53,       5},
+    { 72,        554898,      93744157,           3,       123,       3},
+    { 55,        289131,      93749998,           3,        85,       3},
+    { 42,         11682,      94012845,           5,        45,       5},
+    { 64,        297893,      94021607,           3,        87,       3},
+    { 74,        169390,      94293215,           3,       108,       3},
+    { 55,        201515,      94299056,           3,        90,       3},
+    { 72,         43807,      94439241,           3,       108,       3},
+    { 62,        806063,      94538539,           2,       110,       2},
+    { 64,        300813,      94567744,           3,        70,       3},
+    { 67,        633753,      94570665,           4,       102,       4},
+    { 31,        511091,      94573585,           1,       122,       1},
+    { 72,        169390,      94687485,           3,       106,       3},
+    { 74,        128502,      94827670,           3,       110,       3},
+    { 42,         11682,      94853955,           5,        45,       5},
+    { 55,        195674,      94859796,           3,        88,       3},
+    { 65,         78854,      95125563,           3,        90,       3},
+    { 31,        277449,      95134325,           1,       113,       1},
+    { 71,          8761,      95175212,           3,        96,       3},
+    { 76,        566581,      95411775,           4,       102,       4},
+    { 36,        481885,      95414695,           1,       125,       1},
+    { 60,        335859,      95423457,           3,        77,       3},
+    { 72,        119741,      95429298,           3,        90,       3},
+    { 64,         32125,      95540277,           3,        58,       3},
+    { 79,        116820,      95569483,           3,        86,       3},
+    { 67,        108059,      95695065,           3,       112,       3},
+    { 79,        131423,      95835250,           3,       125,       3},
+    { 42,         11682,      95975435,           5,        43,       5},
+    { 69,        110979,      95990038,           3,       108,       3},
+    { 79,        134343,      96130223,           3,       125,       3},
+    { 41,        195674,      96255805,           1,       124,       1},
+    { 67,         37966,      96264567,           3,        98,       3},
+    { 65,         73013,      96267487,           3,       102,       3},
+    { 71,        105138,      96270408,           3,        94,       3},
+    { 72,         26284,      96378467,           3,        94,       3},
+    { 79,        122661,      96407672,           3,       110,       3},
+    { 40,        169390,      96536175,           1,       124,       1},
+    { 64,         75933,      96544937,           3,       108,       3},
+    { 72,         96377,      96547857,           3,       116,       3},
+    { 79,        125582,      96690963,           3,       106,       3},
+    { 38,        131423,      96816545,           1,       121,       1},
+    { 62,         75933,      96822386,           3,       114,       3},
+    { 74,        108059,      96828227,           3,       110,       3},
+    { 79,        113900,      96965492,           3,       112,       3},
+    { 72,        432237,      97096915,           4,       102,       4},
+    { 60,         84695,      97099836,           3,       118,       3},
+    { 76,        195674,      97105677,           3,       114,       3},
+    { 79,        154787,      97257544,           3,       108,       3},
+    { 84,        195674,      97377285,           3,       114,       3},
+    { 83,        163549,      97526232,           3,       120,       3},
+    { 57,        569501,      97637211,           3,        80,       3},
+    { 81,        189833,      97645973,           3,       120,       3},
+    { 29,        461442,      97657655,           1,       124,       1},
+    { 65,        341700,      97663496,           2,       101,       2},
+    { 72,        335859,      97666417,           2,       101,       2},
+    { 69,        367985,      97669337,           2,       114,       2},
+    { 79,        116820,      97797840,           3,       108,       3},
+    { 77,        195674,      97929263,           3,       106,       3},
+    { 42,         11682,      97938025,           5,        44,       5},
+    { 76,        143105,      98072369,           3,        96,       3},
+    { 59,        312495,      98186269,           3,        79,       3},
+    { 31,        405952,      98218395,           1,       124,       1},
+    { 79,        172310,      98349818,           3,       114,       3},
+    { 77,        186913,      98495845,           3,        92,       3},
+    { 42,         11682,      98498765,           5,        43,       5},
+    { 74,        169390,      98647712,           3,        94,       3},
+    { 64,       1880815,      98767453,           2,        97,       2},
+    { 28,       1682219,      98779135,           1,       126,       1},
+    { 56,       1693902,      98787897,           3,        69,       3},
+    { 68,       1495306,      98793738,           2,        97,       2},
+    { 77,        172310,      98968969,           3,        88,       3},
+    { 76,        148946,      99100392,           3,        92,       3},
+    { 75,        183992,      99234736,           3,        92,       3},
+    { 76,        128502,      99372001,           3,       110,       3},
+    { 71,        195674,      99488822,           3,       100,       3},
+    { 76,        166469,      99626086,           3,       120,       3},
+    { 81,         11682,      99634848,           5,        30,       5},
+    { 75,        172310,      99766271,           3,       104,       3},
+    { 76,        125582,      99903536,           3,       108,       3},
+    { 71,        172310,     100032038,           3,       106,       3},
+    { 76,        157708,     100169303,           3,       106,       3},
+    { 75,        146026,     100309488,           3,        92,       3},
+    { 76,        955010,     100467196,           3,       110,       3},
+    { 81,         11682,     100478878,           5,        32,       5},
+    { 71,        420554,     101319988,           3,        94,       3},
+    { 76,        335859,     101603279,           3,       120,       3},
+    { 75,        371925,     101880728,           3,       108,       3},
+    { 81,         11792,     102143575,           5,        34,       5},
+    { 76,        840200,     102167160,           3,        96,       3},
+    { 71,        333132,     103010308,           3,        84,       3},
+    { 76,        229949,     103296272,           3,        96,       3},
+    { 75,        294807,     103567494,           3,       104,       3},
+    { 76,        294807,     103844613,           3,       100,       3},
+    { 75,        321339,     104115836,           3,        96,       3},
+    { 76,        294864,     104398851,           3,       108,       3},
+    { 71,        297020,     104667125,           3,        94,       3},
+    { 74,        300479,     104970156,           3,        98,       3},
+    { 76,       1385208,     105553085,           4,       102,       4},
+    { 33,       1664654,     105556090,           1,       115,       1},
+    { 45,        736173,     105574119,           3,        69,       3},
+    { 42,         12019,     105844550,           5,        45,       5},
+    { 52,        588939,     105853564,           3,        78,       3},
+    { 42,         12019,     106133010,           5,        43,       5},
+    { 57,        231368,     106142024,           3,        76,       3},
+    { 60,        390622,     106418465,           3,        86,       3},
+    { 81,         12019,     106421470,           5,        34,       5},
+    { 64,        324517,     106700916,           3,       104,       3},
+    { 42,         12019,     106709930,           5,        45,       5},
+    { 69,          9014,     106950313,           3,       104,       3},
+    { 42,         12019,     106998390,           5,        43,       5},
+    { 28,       1633052,     107253797,           1,       116,       1},
+    { 40,        290144,     107274831,           3,        85,       3},
+    { 71,        568509,     107280840,           4,       102,       4},
+    { 74,       1606129,     107283845,           4,       102,       4},
+    { 35,         12500,     107286850,           5,       103,       5},
+    { 52,        340625,     107568100,           3,        88,       3},
+    { 42,         12500,     107586850,           5,        45,       5},
+    { 42,         12500,     107886850,           5,        43,       5},
+    { 56,        153125,     107889975,           3,        79,       3},
+    { 64,        381250,     108186850,           3,       100,       3},
+    { 68,        353125,     108474350,           3,       108,       3},
+    { 42,         12500,     108486850,           5,        45,       5},
+    { 71,        181250,     108743100,           3,       112,       3},
+    { 42,         12500,     108786850,           5,        43,       5},
+    { 33,       1781934,     109052475,           1,       116,       1},
+    { 69,       1805387,     109080600,           4,       102,       4},
+    { 46,         12135,     109086850,           5,        45,       5},
+    { 45,        706912,     109095952,           3,        80,       3},
+    { 52,        424754,     109381144,           3,        80,       3},
+    { 57,        166867,     109684540,           3,        79,       3},
+    { 64,        385312,     109969732,           3,        92,       3},
+    { 76,        345871,     110267060,           3,       112,       3},
+    { 75,        288226,     110543150,           3,       112,       3},
+    { 76,        348905,     110831376,           3,       104,       3},
+    { 75,        169901,     111116568,           3,       100,       3},
+    { 76,        166867,     111416930,           3,       100,       3},
+    { 71,        351939,     111714258,           3,        87,       3},
+    { 74,        309463,     112008552,           3,        92,       3},
+    { 76,       1492707,     112578936,           4,       102,       4},
+    { 33,       1586760,     112581970,           1,       115,       1},
+    { 69,        373176,     112588038,           3,        84,       3},
+    { 45,        624995,     112603208,           3,        70,       3},
+    { 42,         12135,     112873230,           5,        45,       5},
+    { 52,        391380,     112888400,           3,        79,       3},
+    { 42,         12135,     113164490,           5,        43,       5},
+    { 57,        154731,     113170558,           3,        84,       3},
+    { 60,        382278,     113443614,           3,        98,       3},
+    { 37,         12135,     113455750,           5,        82,       5},
+    { 64,        288226,     113747010,           3,       100,       3},
+    { 42,         12135,     114038270,           5,        43,       5},
+    { 69,         81916,     114065576,           3,       108,       3},
+    { 28,       1604963,     114305258,           1,       118,       1},
+    { 68,       1577658,     114326496,           4,       102,       4},
+    { 42,         12135,     114329530,           5,        53,       5},
+    { 71,        527908,     114335598,           3,       110,       3},
+    { 40,        245750,     114359870,           3,        87,       3},
+    { 42,         12135,     114620790,           5,        45,       5},
+    { 52,        270022,     114629892,           3,        94,       3},
+    { 42,         12135,     114912050,           5,        43,       5},
+    { 56,        112256,     114927220,           3,        80,       3},
+    { 37,         12135,     115203310,           5,        82,       5},
+    { 64,        373176,     115209378,           3,       100,       3},
+    { 42,         12135,     115494570,           5,        45,       5},
+    { 72,        336769,     115497604,           3,       108,       3},
+    { 71,        103154,     115776728,           3,       106,       3},
+    { 42,         12135,     115785830,           5,        43,       5},
+    { 60,        967832,     115995173,           2,        87,       2},
+    { 64,        761523,     116074056,           4,       102,       4},
+    { 33,        810066,     116077090,           1,       118,       1},
+    { 69,        476331,     116080124,           3,        92,       3},
+    { 45,        394414,     116107430,           3,        76,       3},
+    { 42,         12135,     116368350,           5,        45,       5},
+    { 52,        324633,     116371384,           3,        84,       3},
+    { 42,         12135,     116659610,           5,        43,       5},
+    { 57,        139562,     116674780,           3,        84,       3},
+    { 55,        895017,     116950870,           2,        69,       2},
+    { 67,        770625,     116953904,           2,        87,       2},
+    { 62,        758489,     116956938,           2,        86,       2},
+    { 81,         12135,     116966040,           5,        25,       5},
+    { 71,        379244,     116972108,           3,       112,       3},
+    { 42,         12135,     117242130,           5,        45,       5},
+    { 81,         12135,     117248198,           5,        28,       5},
+    { 72,        254852,     117257300,           3,       123,       3},
+    { 81,         12135,     117530356,           5,        35,       5},
+    { 42,         12135,     117533390,           5,        43,       5},
+    { 74,        348905,     117536424,           3,       110,       3},
+    { 64,       1617099,     117806446,           2,        77,       2},
+    { 36,       1513945,     117818582,           1,       124,       1},
+    { 35,         12135,     117824650,           5,       103,       5},
+    { 72,       1541250,     117827684,           4,       102,       4},
+    { 76,        442957,     117833752,           3,       100,       3},
+    { 48,        570384,     117848922,           3,        79,       3},
+    { 42,         12135,     118115910,           5,        45,       5},
+    { 55,        394414,     118137148,           3,        86,       3},
+    { 42,         12135,     118407170,           5,        43,       5},
+    { 60,        151697,     118431442,           3,        87,       3},
+    { 37,         12135,     118698430,           5,        82,       5},
+    { 67,        385312,     118719668,           3,       102,       3},
+    { 42,         12135,     118989690,           5,        45,       5},
+    { 77,        358007,     119013962,           3,       112,       3},
+    { 76,          6067,     119277916,           3,       114,       3},
+    { 35,         12135,     119280950,           5,        79,       5},
+    { 67,        643199,     119569176,           4,       102,       4},
+    { 35,         12135,     119572210,           5,       103,       5},
+    { 31,        716014,     119575244,           1,       120,       1},
+    { 71,       1531392,     119578278,           2,        86,       2},
+    { 43,        276090,     119593448,           3,        79,       3},
+    { 74,        321599,     119608618,           2,        76,       2},
+    { 42,         12135,     119863470,           5,        45,       5},
+    { 55,        254852,     119878640,           3,        84,       3},
+    { 42,         12135,     120154730,           5,        43,       5},
+    { 59,        151697,     120169900,           3,        87,       3},
+    { 56,        878541,     120415650,           2,        85,       2},
+    { 68,        776831,     120442956,           2,        83,       2},
+    { 37,         11904,     120445990,           5,        82,       5},
+    { 32,        705346,     120448966,           1,       123,       1},
+    { 65,        339280,     120466823,           3,        92,       3},
+    { 42,         11904,     120731700,           5,        45,       5},
+    { 76,        327376,     120746581,           3,       100,       3},
+    { 42,         11904,     121017410,           5,        43,       5},
+    { 74,        160711,     121020386,           3,        96,       3},
+    { 69,       1461287,     121303120,           4,       102,       4},
+    { 76,       1389860,     121306096,           4,       102,       4},
+    { 72,        434517,     121309072,           3,        89,       3},
+    { 33,       1178553,     121312048,           1,       120,       1},
+    { 42,         11904,     121588830,           5,        45,       5},
+    { 52,        369042,     121612639,           3,        70,       3},
+    { 57,        133926,     121874540,           3,        80,       3},
+    { 81,         11904,     122160250,           5,        34,       5},
+    { 64,        315471,     122192988,           3,        84,       3},
+    { 42,         11904,     122445960,           5,        45,       5},
+    { 74,        273805,     122448936,           3,        85,       3},
+    { 42,         11904,     122731670,           5,        43,       5},
+    { 33,        285710,     122743575,           1,       123,       1},
+    { 72,        151783,     122752503,           3,        92,       3},
+    { 68,       1711283,     123011428,           4,       102,       4},
+    { 46,         11904,     123017380,           5,        43,       5},
+    { 28,       3446376,     123026308,           1,       121,       1},
+    { 71,        312495,     123032261,           3,        88,       3},
+    { 40,         92260,     123067974,           3,        83,       3},
+    { 52,        169640,     123332851,           3,        90,       3},
+    { 64,         62499,     123615585,           3,       105,       3},
+    { 64,        273805,     123883438,           3,       123,       3},
+    { 76,        110117,     124198910,           3,       113,       3},
+    { 64,        226187,     124466763,           3,       116,       3},
+    { 76,         98212,     124746521,           3,       116,       3},
+    { 76,        351185,     125026278,           3,       110,       3},
+    { 88,         86308,     125317941,           3,       108,       3},
+    { 75,        297614,     125594722,           3,       110,       3},
+    { 76,        124998,     125889361,           3,       103,       3},
+    { 75,        312495,     126169118,           3,        98,       3},
+    { 76,         29761,     126448876,           3,       100,       3},
+    { 75,        351185,     126716729,           3,       104,       3},
+    { 76,        377970,     127005415,           3,       102,       3},
+    { 71,        404755,     127291125,           3,        96,       3},
+    { 74,        288686,     127594692,           3,        98,       3},
+    { 33,       1680812,     128160160,           1,       115,       1},
+    { 45,        661402,     128172296,           3,        88,       3},
+    { 69,        370142,     128178364,           2,        50,       2},
+    { 42,         12135,     128451420,           5,        45,       5},
+    { 52,        354973,     128463556,           3,        88,       3},
+    { 42,         12135,     128742680,           5,        43,       5},
+    { 57,        154731,     128748748,           3,        80,       3},
+    { 81,         12135,     129033940,           5,        34,       5},
+    { 60,        318565,     129040008,           3,        87,       3},
+    { 42,         12135,     129325200,           5,        45,       5},
+    { 64,        342837,     129328234,           3,        96,       3},
+    { 69,         87984,     129604324,           3,       104,       3},
+    { 42,         12135,     129616460,           5,        43,       5},
+    { 59,       1805205,     129840973,           2,        75,       2},
+    { 28,       1586760,     129874346,           1,       116,       1},
+    { 74,       1447198,     129904686,           4,       102,       4},
+    { 42,         12135,     129907720,           5,        53,       5},
+    { 40,        257886,     129913788,           3,        79,       3},
+    { 52,        288226,     130195946,           3,        82,       3},
+    { 42,         12135,     130198980,           5,        45,       5},
+    { 56,        142596,     130481138,           3,        90,       3},
+    { 42,         12135,     130490240,           5,        43,       5},
+    { 64,        391380,     130772398,           3,       104,       3},
+    { 42,         12135,     130781500,           5,        44,       5},
+    { 68,        303395,     131060624,           3,       108,       3},
+    { 42,         12135,     131072760,           5,        45,       5},
+    { 71,         21237,     131339748,           3,       112,       3},
+    { 35,         12135,     131364020,           5,        79,       5},
+    { 60,       1240888,     131603703,           2,        81,       2},
+    { 33,       1780933,     131621906,           1,       116,       1},
+    { 69,       1231787,     131649212,           4,       102,       4},
+    { 35,         12135,     131655280,           5,       103,       5},
+    { 45,        473297,     131664382,           3,        70,       3},
+    { 52,        321599,     131964744,           3,        80,       3},
+    { 57,        136528,     132259038,           3,        85,       3},
+    { 64,        321599,     132541196,           3,        90,       3},
+    { 76,        312497,     132835490,           3,       110,       3},
+    { 75,        370142,     133108546,           3,       100,       3},
+    { 76,        342837,     133399806,           3,       106,       3},
+    { 75,        345871,     133688032,           3,       102,       3},
+    { 76,        342837,     133988394,           3,        94,       3},
+    { 71,        370142,     134267518,           3,        92,       3},
+    { 74,        282158,     134567880,           3,        85,       3},
+    { 72,         30339,     135144332,           4,       102,       4},
+    { 76,       1419892,     135147366,           4,       102,       4},
+    { 33,       1586760,     135150400,           1,       115,       1},
+    { 45,        452059,     135165570,           3,        61,       3},
+    { 42,         12135,     135441660,           5,        45,       5},
+    { 52,        324633,     135462898,           3,        70,       3},
+    { 42,         12135,     135732920,           5,        43,       5},
+    { 57,        136528,     135748090,           3,        82,       3},
+    { 60,        345871,     136018112,           3,       100,       3},
+    { 42,         12135,     136024180,           5,        44,       5},
+    { 64,        330701,     136303304,           3,       108,       3},
+    { 42,         12135,     136315440,           5,        45,       5},
+    { 69,         33373,     136579394,           3,       112,       3},
+    { 35,         12135,     136606700,           5,        81,       5},
+    { 59,       1771831,     136828179,           2,        78,       2},
+    { 28,       1604963,     136873688,           1,       118,       1},
+    { 40,        291259,     136885824,           3,        78,       3},
+    { 68,       1568556,     136891892,           4,       102,       4},
+    { 74,       1447198,     136894926,           4,       102,       4},
+    { 35,         12135,     136897960,           5,       103,       5},
+    { 42,         12135,     137189220,           5,        45,       5},
+    { 52,        330701,     137198322,           3,        83,       3},
+    { 42,         12135,     137480480,           5,        43,       5},
+    { 56,        130460,     137510820,           3,        90,       3},
+    { 37,         12135,     137771740,           5,        82,       5},
+    { 64,        330701,     137802080,           3,       108,       3},
+    { 42,         12135,     138063000,           5,        45,       5},
+    { 72,        336769,     138081204,           3,       108,       3},
+    { 42,         12135,     138354260,           5,        43,       5},
+    { 71,        273056,     138357294,           3,       100,       3},
+    { 57,       3767668,     138624282,           3,        75,       3},
+    { 45,       3840180,     138645520,           3,        55,       3},
+    { 72,       4283573,     138648554,           4,       102,       4},
+    { 60,       3696457,     138691029,           3,        85,       3},
+    { 64,       3579866,     138718335,           3,        57,       3},
+    { 69,       3545972,     138779014,           3,        89,       3},
 
 };
 
+// channel names, indexed by the channel column of the tones (MIDI channel 10 is DRUMS)
 static std::vector<std::string> songChannels =
 {
     "",
@@ -1053,9 +1054,31 @@ static std::vector<std::string> songChannels =
     "GS/RESET"
 };
 
+// one envelope per channel, indexed by the envelope column of the tones
+// (the drums of MIDI channel 10 use the DRUMS envelope)
+//       attack    decay   sustain   release
 static std::vector<AdsrProfile> songEnvelopes =
 {
-    {0, 0, 0, 0},
+    {    0.1f,    0.1f,     0.2f,     0.3f},    // default
+    {   0.005f,   0.4f,     0.5f,     0.2f},    // FRETLESS
+    {    0.3f,    0.3f,     0.8f,     0.6f},    // SLOWSTRING
+    {   0.005f,   0.3f,     0.4f,     0.3f},    // MELODY
+    {   0.002f,  0.15f,     0.3f,     0.8f},    // ICE RAIN
+    {   0.001f,  0.05f,     0.0f,     0.0f},    // DRUMS
+    {    0.1f,    0.1f,     0.2f,     0.3f},    // GS/RESET
+};
+
+// default pan position per channel (0 left, 64 center, 127 right), indexed by the
+// channel column of the tones
+static std::vector<uint8_t> songChannelPans =
+{
+    64,     // default
+    56,     // FRETLESS
+    36,     // SLOWSTRING
+    72,     // MELODY
+    96,     // ICE RAIN
+    64,     // DRUMS
+    64,     // GS/RESET
 };
 
 std::span<ui_tone> CSongGetTones()
@@ -1073,6 +1096,11 @@ const std::vector<AdsrProfile>* CSongGetEnvelopes()
     return &songEnvelopes;
 }
 
+const std::vector<uint8_t>* CSongGetChannelPans()
+{
+    return &songChannelPans;
+}
+
 const std::string* CSongGetName()
 {
     return &songName;
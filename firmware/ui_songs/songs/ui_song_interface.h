@@ -22,6 +22,7 @@
 std::span<ui_tone> CSongGetTones();
 const std::vector<std::string>* CSongGetChannels();
 const std::vector<AdsrProfile>* CSongGetEnvelopes();
+const std::vector<uint8_t>* CSongGetChannelPans();
 const std::string* CSongGetName();
 const uint16_t* CSongGetBPM();
 const uint32_t* CSongGetDuration();
\ No newline at end of file
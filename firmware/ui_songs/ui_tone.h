@@ -12,7 +12,7 @@
 #pragma once
 
 #include <stdint.h>
-#include <../ToneSheduler.h>
+#include "../ToneSheduler.h"
 
 
 /**
@@ -21,25 +21,25 @@
  */
 struct ui_tone
 {
-    float frequency;        /**< Frequency of the tone */
+    uint8_t note;           /**< MIDI note number of the tone */
     uint32_t duration;      /**< Duration of the tone */
     uint32_t startTime;     /**< Start time of the tone */
     uint16_t channelIdx;    /**< Channel index of the tone */
     uint16_t velocity;      /**< Velocity of the tone */
-    AdsrProfile *adsr;      /**< Pointer to ADSR-Profile */
+    uint8_t envelopeIdx;    /**< Index of the ADSR-Profile in the envelopes of the song */
 
     /**
      * @brief Construct a new ui tone object
      * 
-     * @param frequency Frequency of the tone
+     * @param note MIDI note number of the tone
      * @param duration Duration of the tone
      * @param startTime Start time of the tone
      * @param channelIdx Channel of the tone
      * @param velocity Velocity of the tone
-     * @param adsr ADSR index of the tone
+     * @param envelopeIdx ADSR index of the tone
      */
-    ui_tone(float frequency, uint32_t duration, uint32_t startTime, uint16_t channelIdx = 0, uint16_t velocity = 128, AdsrProfile *adsr = nullptr)
-        : frequency(frequency), duration(duration), startTime(startTime), channelIdx(channelIdx), velocity(velocity), adsr(adsr) {}
+    ui_tone(uint8_t note, uint32_t duration, uint32_t startTime, uint16_t channelIdx = 0, uint16_t velocity = 128, uint8_t envelopeIdx = 0)
+        : note(note), duration(duration), startTime(startTime), channelIdx(channelIdx), velocity(velocity), envelopeIdx(envelopeIdx) {}
     
 
     uint32_t getEndTime() const { return startTime + duration; }